@@ -0,0 +1,266 @@
+/******************************************************************************
+ * @file     OpenCLBench.cpp
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Micro-benchmarks of OpenCL device features
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <cstring>
+#include <sys/time.h>
+#else
+#include <windows.h>
+#endif
+
+#include "OpenCLInfo.h"
+#include "OpenCLOutput.h"
+#include "OpenCLBench.h"
+
+
+    static std::string HGPU_bench_key;     // current benchmark, prefix of structured field names
+
+    static bool
+    HGPU_bench_text( void )
+    {
+        return ( HGPU_output_format() == HGPU_OUTPUT_FORMAT_TEXT );
+    }
+
+    static std::string
+    HGPU_bench_field( const char* name, const char* quantity )
+    {
+        std::string field = "bench " + HGPU_bench_key + " / " + name;
+        if( quantity )
+        {
+            field += " / ";
+            field += quantity;
+        }
+        return field;
+    }
+
+    static void
+    HGPU_bench_vrow( const char* name, const char* format, va_list args )
+    {
+        printf( HGPU_BENCH_FMT_NSTR, name );
+        vprintf( format, args );
+        printf( "\n" );
+    }
+
+    void
+    HGPU_bench_title( const char* key, const char* title )
+    {
+        HGPU_bench_key = key;
+        if( HGPU_bench_text() )
+            printf( HGPU_BENCH_FMT_TITLE, title );
+    }
+
+    void
+    HGPU_bench_row( const char* name, const char* format, ... )
+    {
+        if( !HGPU_bench_text() )
+            return;
+        va_list args;
+        va_start( args, format );
+        HGPU_bench_vrow( name, format, args );
+        va_end( args );
+    }
+
+    void
+    HGPU_bench_string( const char* name, const char* format, ... )
+    {
+        va_list args;
+        va_start( args, format );
+        if( HGPU_bench_text() )
+            HGPU_bench_vrow( name, format, args );
+        else
+        {
+            char value[1024];
+            vsnprintf( value, sizeof(value), format, args );
+            HGPU_output_str( HGPU_bench_field( name, NULL ).c_str(), value );
+        }
+        va_end( args );
+    }
+
+    void
+    HGPU_bench_value( const char* name, const char* quantity, double value, const char* unit )
+    {
+        if( !HGPU_bench_text() )
+            HGPU_output_real( HGPU_bench_field( name, quantity ).c_str(), value, unit );
+    }
+
+    void
+    HGPU_bench_count( const char* name, const char* quantity, unsigned long long value, const char* unit )
+    {
+        if( !HGPU_bench_text() )
+            HGPU_output_uint( HGPU_bench_field( name, quantity ).c_str(), value, HGPU_OUT_FMT_NONE, unit );
+    }
+
+    void
+    HGPU_bench_note( const char* name, const char* quantity, const char* value )
+    {
+        if( !HGPU_bench_text() )
+            HGPU_output_str( HGPU_bench_field( name, quantity ).c_str(), value );
+    }
+
+    int
+    HGPU_bench_parse( const char* bench_name )
+    {
+        if( !strcmp( bench_name, "enqueue"  ) ) return HGPU_BENCH_ENQUEUE;
+        if( !strcmp( bench_name, "constant" ) ) return HGPU_BENCH_CONSTANT;
+        if( !strcmp( bench_name, "reduce"   ) ) return HGPU_BENCH_REDUCE;
+        if( !strcmp( bench_name, "all"      ) ) return HGPU_BENCH_ALL;
+        return 0;
+    }
+
+    double
+    HGPU_timer_get( void )
+    {
+#ifdef _WIN32
+        LARGE_INTEGER frequency, counter;
+        QueryPerformanceFrequency( &frequency );
+        QueryPerformanceCounter( &counter );
+        return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+        struct timeval tv;
+        gettimeofday( &tv, NULL );
+        return (double) tv.tv_sec + (double) tv.tv_usec * 1e-6;
+#endif
+    }
+
+    bool
+    HGPU_bench_error( cl_int error_code, const char* error_message )
+    {
+        if( error_code == CL_SUCCESS )
+            return false;
+        HGPU_bench_string( error_message, "skipped, error %i", error_code );
+        return true;
+    }
+
+    bool
+    HGPU_bench_env_create( cl_device_id device, HGPU_bench_env& env )
+    {
+        cl_int CLerr = CL_SUCCESS;
+        env.device  = device;
+        env.queue   = NULL;
+        env.context = clCreateContext( NULL, 1, &device, NULL, NULL, &CLerr );
+        if( HGPU_bench_error( CLerr, "clCreateContext" ) )
+            return false;
+        env.queue = clCreateCommandQueue( env.context, device, CL_QUEUE_PROFILING_ENABLE, &CLerr );
+        if( HGPU_bench_error( CLerr, "clCreateCommandQueue" ) )
+        {
+            HGPU_bench_env_release( env );
+            return false;
+        }
+        return true;
+    }
+
+    void
+    HGPU_bench_env_release( HGPU_bench_env& env )
+    {
+        if( env.queue   ) clReleaseCommandQueue( env.queue );
+        if( env.context ) clReleaseContext( env.context );
+        env.queue   = NULL;
+        env.context = NULL;
+    }
+
+    cl_program
+    HGPU_bench_program_build( HGPU_bench_env& env, const char* source, const char* options )
+    {
+        cl_int CLerr = CL_SUCCESS;
+        cl_program program = clCreateProgramWithSource( env.context, 1, &source, NULL, &CLerr );
+        if( HGPU_bench_error( CLerr, "clCreateProgramWithSource" ) )
+            return NULL;
+
+        CLerr = clBuildProgram( program, 1, &env.device, options, NULL, NULL );
+        if( CLerr != CL_SUCCESS )
+        {
+            size_t log_size = 0;
+            HGPU_bench_error( CLerr, "clBuildProgram" );
+            if( ( clGetProgramBuildInfo( program, env.device, CL_PROGRAM_BUILD_LOG, 0, NULL, &log_size ) == CL_SUCCESS ) && ( log_size > 1 ) )
+            {
+                std::vector<char> build_log( log_size + 1, 0 );
+                clGetProgramBuildInfo( program, env.device, CL_PROGRAM_BUILD_LOG, log_size, &build_log[0], NULL );
+                HGPU_output_message( "%s\n", &build_log[0] );
+            }
+            clReleaseProgram( program );
+            return NULL;
+        }
+        return program;
+    }
+
+    double
+    HGPU_bench_event_time( cl_event event )
+    {
+        cl_ulong time_start = 0;
+        cl_ulong time_end   = 0;
+        clWaitForEvents( 1, &event );
+        clGetEventProfilingInfo( event, CL_PROFILING_COMMAND_START, sizeof(time_start), &time_start, NULL );
+        clGetEventProfilingInfo( event, CL_PROFILING_COMMAND_END,   sizeof(time_end),   &time_end,   NULL );
+        clReleaseEvent( event );
+        return ( time_end - time_start ) * 1e-9;
+    }
+
+    double
+    HGPU_bench_kernel_time( HGPU_bench_env& env, cl_kernel kernel, size_t global_size, size_t local_size, int repeats )
+    {
+        double time_best = -1.0;
+        for( int i = 0; i <= repeats; i++ )
+        {
+            cl_event event = NULL;
+            cl_int CLerr = clEnqueueNDRangeKernel( env.queue, kernel, 1, NULL, &global_size, ( local_size ? &local_size : NULL ), 0, NULL, &event );
+            if( CLerr != CL_SUCCESS )
+                return -1.0;
+            double time_kernel = HGPU_bench_event_time( event );
+            if( i && ( ( time_best < 0.0 ) || ( time_kernel < time_best ) ) )
+                time_best = time_kernel;
+        }
+        return time_best;
+    }
+
+    void
+    HGPU_bench_run( cl_device_id device, int device_opencl_c_version, int bench_mask )
+    {
+        HGPU_bench_env env;
+        if( !HGPU_bench_env_create( device, env ) )
+            return;
+
+        if( bench_mask & HGPU_BENCH_ENQUEUE  ) HGPU_bench_enqueue( env, device_opencl_c_version );
+        if( bench_mask & HGPU_BENCH_CONSTANT ) HGPU_bench_constant( env );
+        if( bench_mask & HGPU_BENCH_REDUCE   ) HGPU_bench_reduce( env, device_opencl_c_version );
+
+        HGPU_bench_env_release( env );
+    }
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * @file     OpenCLBench.h
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Micro-benchmarks of OpenCL device features
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#ifndef OPENCLBENCH_H
+#define OPENCLBENCH_H
+
+#ifndef CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#endif
+
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#endif
+
+
+#define HGPU_BENCH_ENQUEUE          0x01
+#define HGPU_BENCH_CONSTANT         0x02
+#define HGPU_BENCH_REDUCE           0x04
+#define HGPU_BENCH_ALL              0xFF
+
+#define HGPU_BENCH_FMT_TITLE        "Benchmark: %s\n"
+#define HGPU_BENCH_FMT_NSTR         "    %-42s: "
+
+    struct HGPU_bench_env
+    {
+        cl_device_id     device;
+        cl_context       context;
+        cl_command_queue queue;     // in-order host queue with profiling enabled
+    };
+
+    // parse benchmark name from command line; returns 0 for unknown name
+    int              HGPU_bench_parse( const char* bench_name );
+    // run all benchmarks selected in bench_mask on device
+    void             HGPU_bench_run( cl_device_id device, int device_opencl_c_version, int bench_mask );
+
+    // results: text prints rows as "name: value"; structured formats get fields "bench <key> / <name>[ / <quantity>]"
+    void             HGPU_bench_title( const char* key, const char* title );
+    // text row only; typed values of the row go through HGPU_bench_value/count/note
+    void             HGPU_bench_row( const char* name, const char* format, ... );
+    // text row and the same string as structured field (skips, errors, summaries)
+    void             HGPU_bench_string( const char* name, const char* format, ... );
+    void             HGPU_bench_value( const char* name, const char* quantity, double value, const char* unit );
+    void             HGPU_bench_count( const char* name, const char* quantity, unsigned long long value, const char* unit );
+    void             HGPU_bench_note( const char* name, const char* quantity, const char* value );
+
+    double           HGPU_timer_get( void );
+    bool             HGPU_bench_error( cl_int error_code, const char* error_message );
+    bool             HGPU_bench_env_create( cl_device_id device, HGPU_bench_env& env );
+    void             HGPU_bench_env_release( HGPU_bench_env& env );
+    cl_program       HGPU_bench_program_build( HGPU_bench_env& env, const char* source, const char* options );
+    double           HGPU_bench_event_time( cl_event event );
+    // best of repeats kernel time in seconds (warm-up run excluded); negative on error
+    double           HGPU_bench_kernel_time( HGPU_bench_env& env, cl_kernel kernel, size_t global_size, size_t local_size, int repeats );
+
+    void             HGPU_bench_enqueue( HGPU_bench_env& env, int device_opencl_c_version );
+    void             HGPU_bench_constant( HGPU_bench_env& env );
+    void             HGPU_bench_reduce( HGPU_bench_env& env, int device_opencl_c_version );
+
+#endif
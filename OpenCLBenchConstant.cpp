@@ -0,0 +1,293 @@
+/******************************************************************************
+ * @file     OpenCLBenchConstant.cpp
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           __constant vs __global vs by-value kernel argument table reads
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <vector>
+
+#ifndef _WIN32
+#include <cstring>
+#endif
+
+#include "OpenCLInfo.h"
+#include "OpenCLOutput.h"
+#include "OpenCLBench.h"
+
+
+#define HGPU_BENCH_CONSTANT_MIN_SIZE    256         // smallest table, bytes
+#define HGPU_BENCH_CONSTANT_MAX_SIZE    (1 << 20)   // largest table, bytes; some runtimes report constant limits of GBs
+#define HGPU_BENCH_CONSTANT_ITERATIONS  1024        // table reads per work-item
+#define HGPU_BENCH_CONSTANT_WORK_ITEMS  (1 << 16)
+#define HGPU_BENCH_CONSTANT_REPEATS     3
+#define HGPU_BENCH_CONSTANT_ARGS_SIZE   64          // room left for non-table kernel arguments
+
+#define HGPU_BENCH_SPACE_CONSTANT       0
+#define HGPU_BENCH_SPACE_GLOBAL         1
+#define HGPU_BENCH_SPACE_VALUE          2
+#define HGPU_BENCH_SPACES               3
+
+#define HGPU_BENCH_ACCESS_BROADCAST     0
+#define HGPU_BENCH_ACCESS_DIVERGENT     1
+#define HGPU_BENCH_ACCESSES             2
+
+// SPACE selects the address space of the table; TABLE_SIZE (floats) is needed only for by-value tables.
+// Broadcast index is uniform across the work-group; work-groups walk consecutive 64-byte lines,
+// so the table is covered up to ITERATIONS * 64 bytes per work-group times the number of work-groups.
+static const char* HGPU_bench_constant_source =
+    "#if ( SPACE == 0 )\n"
+    "#define TABLE_ARG    constant float* restrict table\n"
+    "#define TABLE( i )   table[i]\n"
+    "#elif ( SPACE == 1 )\n"
+    "#define TABLE_ARG    global const float* restrict table\n"
+    "#define TABLE( i )   table[i]\n"
+    "#else\n"
+    "typedef struct { float v[TABLE_SIZE]; } table_t;\n"
+    "#define TABLE_ARG    table_t table\n"
+    "#define TABLE( i )   table.v[i]\n"
+    "#endif\n"
+    "\n"
+    "kernel void read_broadcast( TABLE_ARG, global float* out, uint mask )\n"
+    "{\n"
+    "    float acc = 0.0f;\n"
+    "    for( uint i = 0; i < ITERATIONS; i++ )\n"
+    "        acc += TABLE( ( ( get_group_id( 0 ) * ITERATIONS + i ) * 16u ) & mask );\n"
+    "    out[get_global_id( 0 )] = acc;\n"
+    "}\n"
+    "\n"
+    "kernel void read_divergent( TABLE_ARG, global float* out, uint mask )\n"
+    "{\n"
+    "    uint  gid = get_global_id( 0 );\n"
+    "    float acc = 0.0f;\n"
+    "    for( uint i = 0; i < ITERATIONS; i++ )\n"
+    "        acc += TABLE( ( gid * 33u + i ) & mask );\n"
+    "    out[gid] = acc;\n"
+    "}\n";
+
+static const char* HGPU_bench_space_names[HGPU_BENCH_SPACES]   = { "constant", "global", "by-value" };
+static const char* HGPU_bench_access_names[HGPU_BENCH_ACCESSES] = { "broadcast", "divergent" };
+
+    // runs both access patterns for one table size; results[access] in GB/s, negative if not run
+    static void
+    HGPU_bench_constant_run( HGPU_bench_env& env, cl_program program, int space, cl_mem table, const std::vector<float>& table_host,
+                             size_t table_size, cl_mem out, double* results )
+    {
+        static const char* kernel_names[HGPU_BENCH_ACCESSES] = { "read_broadcast", "read_divergent" };
+        cl_uint mask = (cl_uint) ( table_size / sizeof(cl_float) - 1 );
+
+        for( int a = 0; a < HGPU_BENCH_ACCESSES; a++ )
+        {
+            cl_int CLerr = CL_SUCCESS;
+            results[a] = -1.0;
+            cl_kernel kernel = clCreateKernel( program, kernel_names[a], &CLerr );
+            if( CLerr != CL_SUCCESS )
+                continue;
+            if( space == HGPU_BENCH_SPACE_VALUE )
+                CLerr = clSetKernelArg( kernel, 0, table_size, &table_host[0] );
+            else
+                CLerr = clSetKernelArg( kernel, 0, sizeof(table), &table );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clSetKernelArg( kernel, 1, sizeof(out), &out );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clSetKernelArg( kernel, 2, sizeof(mask), &mask );
+            if( CLerr == CL_SUCCESS )
+            {
+                double time_kernel = HGPU_bench_kernel_time( env, kernel, HGPU_BENCH_CONSTANT_WORK_ITEMS, 0, HGPU_BENCH_CONSTANT_REPEATS );
+                if( time_kernel > 0.0 )
+                    results[a] = (double) HGPU_BENCH_CONSTANT_WORK_ITEMS * HGPU_BENCH_CONSTANT_ITERATIONS * sizeof(cl_float) / time_kernel * 1e-9;
+            }
+            clReleaseKernel( kernel );
+        }
+    }
+
+    static cl_program
+    HGPU_bench_constant_build( HGPU_bench_env& env, int space, size_t table_size )
+    {
+        char options[256];
+        sprintf( options, "-DSPACE=%i -DTABLE_SIZE=%u -DITERATIONS=%u", space, (unsigned int) ( table_size / sizeof(cl_float) ), HGPU_BENCH_CONSTANT_ITERATIONS );
+        return HGPU_bench_program_build( env, HGPU_bench_constant_source, options );
+    }
+
+    static void
+    HGPU_bench_print_size( char* buffer, size_t size )
+    {
+        if( size >= 1024 )
+            sprintf( buffer, "%u KB", (unsigned int) ( size / 1024 ) );
+        else
+            sprintf( buffer, "%u B", (unsigned int) size );
+    }
+
+    void
+    HGPU_bench_constant( HGPU_bench_env& env )
+    {
+        HGPU_bench_title( "constant", "__constant vs __global vs by-value table reads" );
+
+        cl_ulong max_constant  = 0;
+        cl_ulong max_alloc     = 0;
+        size_t   max_parameter = 0;
+        cl_int   CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE, sizeof(max_constant), &max_constant, NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(max_alloc), &max_alloc, NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_PARAMETER_SIZE, sizeof(max_parameter), &max_parameter, NULL );
+        if( HGPU_bench_error( CLerr, "clGetDeviceInfo" ) )
+            return;
+        if( max_constant > max_alloc )
+            max_constant = max_alloc;
+        if( max_constant > HGPU_BENCH_CONSTANT_MAX_SIZE )
+            max_constant = HGPU_BENCH_CONSTANT_MAX_SIZE;
+
+        // table sizes: powers of two from HGPU_BENCH_CONSTANT_MIN_SIZE up to the constant buffer limit
+        std::vector<size_t> sizes;
+        for( size_t size = HGPU_BENCH_CONSTANT_MIN_SIZE; size <= max_constant; size *= 2 )
+            sizes.push_back( size );
+        if( sizes.empty() )
+        {
+            HGPU_bench_string( "__constant", "skipped, constant buffer is too small" );
+            return;
+        }
+
+        std::vector<float> table_host( sizes.back() / sizeof(cl_float) );
+        for( size_t i = 0; i < table_host.size(); i++ )
+            table_host[i] = (float) ( i % 17 );
+
+        cl_mem out   = NULL;
+        cl_mem table = clCreateBuffer( env.context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizes.back(), &table_host[0], &CLerr );
+        if( CLerr == CL_SUCCESS )
+            out = clCreateBuffer( env.context, CL_MEM_WRITE_ONLY, HGPU_BENCH_CONSTANT_WORK_ITEMS * sizeof(cl_float), NULL, &CLerr );
+        if( !HGPU_bench_error( CLerr, "clCreateBuffer" ) )
+        {
+            // results[size][access][space], GB/s
+            std::vector<double> results( sizes.size() * HGPU_BENCH_ACCESSES * HGPU_BENCH_SPACES, -1.0 );
+            double access_results[HGPU_BENCH_ACCESSES];
+
+            for( int space = HGPU_BENCH_SPACE_CONSTANT; space <= HGPU_BENCH_SPACE_GLOBAL; space++ )
+            {
+                cl_program program = HGPU_bench_constant_build( env, space, sizes.back() );
+                if( !program )
+                    continue;
+                for( size_t s = 0; s < sizes.size(); s++ )
+                {
+                    HGPU_bench_constant_run( env, program, space, table, table_host, sizes[s], out, access_results );
+                    for( int a = 0; a < HGPU_BENCH_ACCESSES; a++ )
+                        results[( s * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + space] = access_results[a];
+                }
+                clReleaseProgram( program );
+            }
+
+            // by-value table size is a compile-time constant, so every size needs its own program
+            for( size_t s = 0; ( s < sizes.size() ) && ( sizes[s] + HGPU_BENCH_CONSTANT_ARGS_SIZE <= max_parameter ); s++ )
+            {
+                cl_program program = HGPU_bench_constant_build( env, HGPU_BENCH_SPACE_VALUE, sizes[s] );
+                if( !program )
+                    break;
+                HGPU_bench_constant_run( env, program, HGPU_BENCH_SPACE_VALUE, table, table_host, sizes[s], out, access_results );
+                for( int a = 0; a < HGPU_BENCH_ACCESSES; a++ )
+                    results[( s * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + HGPU_BENCH_SPACE_VALUE] = access_results[a];
+                clReleaseProgram( program );
+            }
+
+            // by-value tables share CL_DEVICE_MAX_PARAMETER_SIZE with the other kernel arguments
+            size_t value_limit = 0;
+            for( size_t s = 0; ( s < sizes.size() ) && ( sizes[s] + HGPU_BENCH_CONSTANT_ARGS_SIZE <= max_parameter ); s++ )
+                value_limit = sizes[s];
+            if( value_limit )
+            {
+                HGPU_bench_row( "by-value limit", "%u bytes (CL_DEVICE_MAX_PARAMETER_SIZE %u bytes)", (unsigned int) value_limit, (unsigned int) max_parameter );
+                HGPU_bench_count( "by-value limit", NULL, value_limit, HGPU_OUTPUT_UNIT_BYTES );
+                HGPU_bench_count( "by-value limit", "CL_DEVICE_MAX_PARAMETER_SIZE", max_parameter, HGPU_OUTPUT_UNIT_BYTES );
+            }
+            else
+                HGPU_bench_string( "by-value", "skipped, CL_DEVICE_MAX_PARAMETER_SIZE %u bytes is below the smallest table", (unsigned int) max_parameter );
+
+            for( int a = 0; a < HGPU_BENCH_ACCESSES; a++ )
+            {
+                int  best_previous = -1;
+                char crossover[512] = "";
+                for( size_t s = 0; s < sizes.size(); s++ )
+                {
+                    char name[64], size_name[32], row[256] = "";
+                    int  best = -1;
+                    HGPU_bench_print_size( size_name, sizes[s] );
+                    sprintf( name, "table %s, %s", size_name, HGPU_bench_access_names[a] );
+                    for( int space = 0; space < HGPU_BENCH_SPACES; space++ )
+                    {
+                        double result = results[( s * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + space];
+                        if( result < 0.0 )
+                        {
+                            sprintf( row + strlen( row ), "%s -, ", HGPU_bench_space_names[space] );
+                            continue;
+                        }
+                        sprintf( row + strlen( row ), "%s %.2f GB/s, ", HGPU_bench_space_names[space], result );
+                        HGPU_bench_value( name, HGPU_bench_space_names[space], result, HGPU_OUTPUT_UNIT_GBPS );
+                        if( ( best < 0 ) || ( result > results[( s * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + best] ) )
+                            best = space;
+                    }
+                    HGPU_bench_row( name, "%sbest %s", row, ( best < 0 ) ? "-" : HGPU_bench_space_names[best] );
+                    if( best >= 0 )
+                        HGPU_bench_note( name, "best", HGPU_bench_space_names[best] );
+
+                    // crossover: table size at which the fastest address space changes; only spaces measured
+                    // at both sizes are compared, so a space dropping out (by-value limit) is not a crossover
+                    int best_before = -1;
+                    int best_now    = -1;
+                    for( int space = 0; s && ( space < HGPU_BENCH_SPACES ); space++ )
+                    {
+                        double result_before = results[( ( s - 1 ) * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + space];
+                        double result_now    = results[( s * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + space];
+                        if( ( result_before < 0.0 ) || ( result_now < 0.0 ) )
+                            continue;
+                        if( ( best_before < 0 ) || ( result_before > results[( ( s - 1 ) * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + best_before] ) )
+                            best_before = space;
+                        if( ( best_now < 0 ) || ( result_now > results[( s * HGPU_BENCH_ACCESSES + a ) * HGPU_BENCH_SPACES + best_now] ) )
+                            best_now = space;
+                    }
+                    if( ( best_now >= 0 ) && ( best_now != best_before ) && ( strlen( crossover ) < sizeof(crossover) - 64 ) )
+                        sprintf( crossover + strlen( crossover ), "%s%s -> %s at %s", ( crossover[0] ? ", " : "" ),
+                                 HGPU_bench_space_names[best_before], HGPU_bench_space_names[best_now], size_name );
+                    if( best >= 0 )
+                        best_previous = best;
+                }
+                char name[64];
+                sprintf( name, "crossover, %s", HGPU_bench_access_names[a] );
+                if( crossover[0] )
+                    HGPU_bench_string( name, "%s", crossover );
+                else if( best_previous >= 0 )
+                    HGPU_bench_string( name, "none, %s fastest for all sizes", HGPU_bench_space_names[best_previous] );
+            }
+        }
+        if( table ) clReleaseMemObject( table );
+        if( out   ) clReleaseMemObject( out );
+    }
@@ -0,0 +1,413 @@
+/******************************************************************************
+ * @file     OpenCLBenchEnqueue.cpp
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Device-side enqueue and pipe throughput benchmark (OpenCL 2.0)
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+
+#include "OpenCLInfo.h"
+#include "OpenCLOutput.h"
+#include "OpenCLBench.h"
+
+
+#define HGPU_BENCH_ENQUEUE_LAUNCHES     4096    // child kernels per device/host batch
+#define HGPU_BENCH_ENQUEUE_PARENTS      64      // parent work-items enqueueing children
+#define HGPU_BENCH_ENQUEUE_ROUNDTRIPS   1024    // host enqueue + clFinish iterations
+#define HGPU_BENCH_PIPE_PACKETS         (1 << 20)
+
+#if defined( CL_VERSION_2_0 )
+
+static const char* HGPU_bench_enqueue_source =
+    "kernel void host_child( global uint* counter )\n"
+    "{\n"
+    "    atomic_inc( counter );\n"
+    "}\n"
+    "\n"
+    "kernel void launch_children( global uint* counter, uint launches )\n"
+    "{\n"
+    "    queue_t queue = get_default_queue();\n"
+    "    for( uint i = 0; i < launches; i++ )\n"
+    "        if( enqueue_kernel( queue, CLK_ENQUEUE_FLAGS_NO_WAIT, ndrange_1D( 1 ), ^{ atomic_inc( counter ); } ) != CLK_SUCCESS )\n"
+    "            atomic_inc( counter + 1 );\n"
+    "}\n";
+
+// PACKET_T and RESERVE are set at build time; RESERVE packets are written/read per work-item
+static const char* HGPU_bench_pipe_source =
+    "kernel void pipe_produce( write_only pipe PACKET_T out, global uint* counter )\n"
+    "{\n"
+    "    PACKET_T packet = (PACKET_T)( (uint) get_global_id( 0 ) );\n"
+    "#if ( RESERVE == 1 )\n"
+    "    if( write_pipe( out, &packet ) == 0 )\n"
+    "        atomic_inc( counter );\n"
+    "#else\n"
+    "    reserve_id_t reserve_id = reserve_write_pipe( out, RESERVE );\n"
+    "    if( is_valid_reserve_id( reserve_id ) )\n"
+    "    {\n"
+    "        for( uint i = 0; i < RESERVE; i++ )\n"
+    "            write_pipe( out, reserve_id, i, &packet );\n"
+    "        commit_write_pipe( out, reserve_id );\n"
+    "        atomic_add( counter, RESERVE );\n"
+    "    }\n"
+    "#endif\n"
+    "}\n"
+    "\n"
+    "kernel void pipe_consume( read_only pipe PACKET_T in, global uint* counter )\n"
+    "{\n"
+    "    PACKET_T packet;\n"
+    "#if ( RESERVE == 1 )\n"
+    "    if( read_pipe( in, &packet ) == 0 )\n"
+    "        atomic_inc( counter );\n"
+    "#else\n"
+    "    reserve_id_t reserve_id = reserve_read_pipe( in, RESERVE );\n"
+    "    if( is_valid_reserve_id( reserve_id ) )\n"
+    "    {\n"
+    "        for( uint i = 0; i < RESERVE; i++ )\n"
+    "            read_pipe( in, reserve_id, i, &packet );\n"
+    "        commit_read_pipe( in, reserve_id );\n"
+    "        atomic_add( counter, RESERVE );\n"
+    "    }\n"
+    "#endif\n"
+    "}\n";
+
+    struct HGPU_bench_packet
+    {
+        const char* type_name;
+        cl_uint     size;
+    };
+
+static const HGPU_bench_packet HGPU_bench_packets[] = {
+    { "uint",     4 },
+    { "uint4",   16 },
+    { "uint16",  64 },
+    { "ulong16", 128 },
+};
+
+static const cl_uint HGPU_bench_reservations[] = { 1, 4, 16, 64 };
+
+    static void
+    HGPU_bench_print_rate( const char* name, cl_uint launches, double seconds )
+    {
+        HGPU_bench_row( name, "%u launches, %.3f us/launch (%.3f M/s)", launches, seconds * 1e6 / launches, launches / seconds * 1e-6 );
+        HGPU_bench_count( name, "launches", launches, NULL );
+        HGPU_bench_value( name, "time per launch", seconds * 1e9 / launches, HGPU_OUTPUT_UNIT_NS );
+        HGPU_bench_value( name, "rate", launches / seconds, HGPU_OUTPUT_UNIT_PER_S );
+    }
+
+    static cl_int
+    HGPU_bench_counter_reset( HGPU_bench_env& env, cl_mem counter )
+    {
+        cl_uint zero[2] = { 0, 0 };
+        return clEnqueueWriteBuffer( env.queue, counter, CL_TRUE, 0, sizeof(zero), zero, 0, NULL, NULL );
+    }
+
+    // host-side launches of host_child, one clFinish per launch for round-trip; returns seconds, negative on error
+    static double
+    HGPU_bench_enqueue_host( HGPU_bench_env& env, cl_kernel host_child, cl_mem counter, cl_uint launches, bool roundtrip, const char* name )
+    {
+        size_t  one      = 1;
+        cl_uint launched = 0;
+        cl_int  CLerr    = HGPU_bench_counter_reset( env, counter );
+
+        double time_start = HGPU_timer_get();
+        for( cl_uint i = 0; ( CLerr == CL_SUCCESS ) && ( i < launches ); i++ )
+        {
+            CLerr = clEnqueueNDRangeKernel( env.queue, host_child, 1, NULL, &one, NULL, 0, NULL, NULL );
+            if( ( CLerr == CL_SUCCESS ) && roundtrip )
+                CLerr = clFinish( env.queue );
+        }
+        if( CLerr == CL_SUCCESS )
+            CLerr = clFinish( env.queue );
+        double seconds = HGPU_timer_get() - time_start;
+        if( CLerr == CL_SUCCESS )
+            CLerr = clEnqueueReadBuffer( env.queue, counter, CL_TRUE, 0, sizeof(launched), &launched, 0, NULL, NULL );
+        if( HGPU_bench_error( CLerr, name ) )
+            return -1.0;
+
+        if( launched != launches )
+        {
+            HGPU_bench_string( name, "wrong result, %u/%u launches counted", launched, launches );
+            return -1.0;
+        }
+        HGPU_bench_print_rate( name, launches, seconds );
+        return seconds;
+    }
+
+    static void
+    HGPU_bench_enqueue_launches( HGPU_bench_env& env, cl_mem counter )
+    {
+        cl_int CLerr = CL_SUCCESS;
+        cl_uint queue_size = 0;
+        cl_queue_properties device_queue_properties[] = {
+            CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CL_QUEUE_ON_DEVICE | CL_QUEUE_ON_DEVICE_DEFAULT,
+            0, 0,
+            0 };
+        // CL_QUEUE_SIZE is set only when the preferred size is known, otherwise the runtime default is used
+        if( ( clGetDeviceInfo( env.device, CL_DEVICE_QUEUE_ON_DEVICE_PREFERRED_SIZE, sizeof(queue_size), &queue_size, NULL ) == CL_SUCCESS ) && queue_size )
+        {
+            device_queue_properties[2] = CL_QUEUE_SIZE;
+            device_queue_properties[3] = queue_size;
+        }
+        cl_command_queue device_queue = clCreateCommandQueueWithProperties( env.context, env.device, device_queue_properties, &CLerr );
+        if( HGPU_bench_error( CLerr, "clCreateCommandQueueWithProperties" ) )
+            return;
+
+        cl_program program = HGPU_bench_program_build( env, HGPU_bench_enqueue_source, "-cl-std=CL2.0" );
+        if( !program )
+        {
+            clReleaseCommandQueue( device_queue );
+            return;
+        }
+        cl_kernel launch_children = NULL;
+        cl_kernel host_child      = clCreateKernel( program, "host_child", &CLerr );
+        if( CLerr == CL_SUCCESS )
+            launch_children = clCreateKernel( program, "launch_children", &CLerr );
+
+        if( CLerr == CL_SUCCESS )
+        {
+            size_t  one      = 1;
+            size_t  parents  = HGPU_BENCH_ENQUEUE_PARENTS;
+            cl_uint launches = HGPU_BENCH_ENQUEUE_LAUNCHES / HGPU_BENCH_ENQUEUE_PARENTS;
+            cl_uint counters[2] = { 0, 0 };
+            clSetKernelArg( host_child,      0, sizeof(counter),  &counter  );
+            clSetKernelArg( launch_children, 0, sizeof(counter),  &counter  );
+            clSetKernelArg( launch_children, 1, sizeof(launches), &launches );
+
+            // warm-up: first launch includes kernel upload and device queue setup
+            CLerr = clEnqueueNDRangeKernel( env.queue, launch_children, 1, NULL, &parents, NULL, 0, NULL, NULL );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clEnqueueNDRangeKernel( env.queue, host_child, 1, NULL, &one, NULL, 0, NULL, NULL );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clFinish( env.queue );
+
+            // device-side: parents enqueue children into the default device queue
+            if( CLerr == CL_SUCCESS )
+                CLerr = HGPU_bench_counter_reset( env, counter );
+            if( !HGPU_bench_error( CLerr, "device enqueue_kernel" ) )
+            {
+                double time_start = HGPU_timer_get();
+                CLerr = clEnqueueNDRangeKernel( env.queue, launch_children, 1, NULL, &parents, NULL, 0, NULL, NULL );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clFinish( env.queue );
+                double time_device = HGPU_timer_get() - time_start;
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clEnqueueReadBuffer( env.queue, counter, CL_TRUE, 0, sizeof(counters), counters, 0, NULL, NULL );
+                // every child is counted either as launched (counters[0]) or as failed to enqueue (counters[1])
+                if( ( CLerr == CL_SUCCESS ) && ( counters[0] + counters[1] != HGPU_BENCH_ENQUEUE_LAUNCHES ) )
+                {
+                    HGPU_bench_string( "device enqueue_kernel", "wrong result, %u/%u launches counted", counters[0] + counters[1], HGPU_BENCH_ENQUEUE_LAUNCHES );
+                    CLerr = CL_INVALID_VALUE;
+                }
+                else if( !HGPU_bench_error( CLerr, "device enqueue_kernel" ) )
+                {
+                    if( counters[0] )
+                        HGPU_bench_print_rate( "device enqueue_kernel", counters[0], time_device );
+                    else
+                        HGPU_bench_string( "device enqueue_kernel", "no launches succeeded" );
+                    if( counters[1] )
+                    {
+                        HGPU_bench_row( "device enqueue_kernel failures", "%u (device queue full)", counters[1] );
+                        HGPU_bench_count( "device enqueue_kernel", "failures (device queue full)", counters[1], NULL );
+                    }
+                }
+
+                // host-side: all children enqueued in one batch
+                double time_batch     = HGPU_bench_enqueue_host( env, host_child, counter, HGPU_BENCH_ENQUEUE_LAUNCHES,   false, "host enqueue, batched" );
+                // host-side: every child waits for the previous one to return to host
+                double time_roundtrip = HGPU_bench_enqueue_host( env, host_child, counter, HGPU_BENCH_ENQUEUE_ROUNDTRIPS, true,  "host enqueue + clFinish (round-trip)" );
+
+                if( ( CLerr == CL_SUCCESS ) && counters[0] )
+                {
+                    double device_per_launch = time_device / counters[0];
+                    if( time_roundtrip > 0.0 )
+                    {
+                        double speedup = ( time_roundtrip / HGPU_BENCH_ENQUEUE_ROUNDTRIPS ) / device_per_launch;
+                        HGPU_bench_row( "device enqueue speedup vs host round-trip", "%.2fx", speedup );
+                        HGPU_bench_value( "device enqueue speedup vs host round-trip", NULL, speedup, NULL );
+                    }
+                    if( time_batch > 0.0 )
+                    {
+                        double speedup = ( time_batch / HGPU_BENCH_ENQUEUE_LAUNCHES ) / device_per_launch;
+                        HGPU_bench_row( "device enqueue speedup vs host batched", "%.2fx", speedup );
+                        HGPU_bench_value( "device enqueue speedup vs host batched", NULL, speedup, NULL );
+                    }
+                }
+            }
+        }
+        else
+            HGPU_bench_error( CLerr, "clCreateKernel" );
+        if( host_child      ) clReleaseKernel( host_child );
+        if( launch_children ) clReleaseKernel( launch_children );
+        clReleaseProgram( program );
+        clReleaseCommandQueue( device_queue );
+    }
+
+    static void
+    HGPU_bench_enqueue_pipe( HGPU_bench_env& env, cl_mem counter, const HGPU_bench_packet& packet, cl_uint reservation, cl_uint packets )
+    {
+        char    options[256];
+        char    name[64];
+        cl_int  CLerr = CL_SUCCESS;
+        cl_uint counters[2] = { 0, 0 };
+        size_t  work_items  = packets / reservation;
+
+        sprintf( options, "-cl-std=CL2.0 -DPACKET_T=%s -DRESERVE=%u", packet.type_name, reservation );
+        sprintf( name, "pipe %u B packets, reserve %u", packet.size, reservation );
+
+        cl_program program = HGPU_bench_program_build( env, HGPU_bench_pipe_source, options );
+        if( !program )
+            return;
+        cl_kernel produce = NULL;
+        cl_kernel consume = NULL;
+        cl_mem    pipe    = clCreatePipe( env.context, CL_MEM_HOST_NO_ACCESS, packet.size, packets, NULL, &CLerr );
+        if( CLerr == CL_SUCCESS )
+            produce = clCreateKernel( program, "pipe_produce", &CLerr );
+        if( CLerr == CL_SUCCESS )
+            consume = clCreateKernel( program, "pipe_consume", &CLerr );
+        if( CLerr == CL_SUCCESS )
+            CLerr = HGPU_bench_counter_reset( env, counter );
+        if( CLerr == CL_SUCCESS )
+        {
+            cl_event event_produce = NULL;
+            cl_event event_consume = NULL;
+            clSetKernelArg( produce, 0, sizeof(pipe),    &pipe    );
+            clSetKernelArg( produce, 1, sizeof(counter), &counter );
+            clSetKernelArg( consume, 0, sizeof(pipe),    &pipe    );
+            clSetKernelArg( consume, 1, sizeof(counter), &counter );
+
+            // producer fills the pipe, then consumer drains it (in-order queue)
+            CLerr = clEnqueueNDRangeKernel( env.queue, produce, 1, NULL, &work_items, NULL, 0, NULL, &event_produce );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clEnqueueReadBuffer( env.queue, counter, CL_TRUE, 0, sizeof(cl_uint), &counters[0], 0, NULL, NULL );
+            if( CLerr == CL_SUCCESS )
+                CLerr = HGPU_bench_counter_reset( env, counter );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clEnqueueNDRangeKernel( env.queue, consume, 1, NULL, &work_items, NULL, 0, NULL, &event_consume );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clEnqueueReadBuffer( env.queue, counter, CL_TRUE, 0, sizeof(cl_uint), &counters[1], 0, NULL, NULL );
+            if( !HGPU_bench_error( CLerr, name ) )
+            {
+                double time_produce = HGPU_bench_event_time( event_produce );
+                double time_consume = HGPU_bench_event_time( event_consume );
+                double write_rate = counters[0] / time_produce;
+                double read_rate  = counters[1] / time_consume;
+                char   moved[64]  = "";
+                if( ( counters[0] != packets ) || ( counters[1] != packets ) )
+                    sprintf( moved, ", %u/%u packets moved", counters[1], packets );
+                HGPU_bench_row( name, "write %.3f GB/s (%.3f Mpkt/s), read %.3f GB/s (%.3f Mpkt/s)%s",
+                                write_rate * packet.size * 1e-9, write_rate * 1e-6, read_rate * packet.size * 1e-9, read_rate * 1e-6, moved );
+                HGPU_bench_value( name, "write", write_rate * packet.size * 1e-9, HGPU_OUTPUT_UNIT_GBPS );
+                HGPU_bench_value( name, "write packets", write_rate, HGPU_OUTPUT_UNIT_PER_S );
+                HGPU_bench_value( name, "read", read_rate * packet.size * 1e-9, HGPU_OUTPUT_UNIT_GBPS );
+                HGPU_bench_value( name, "read packets", read_rate, HGPU_OUTPUT_UNIT_PER_S );
+                HGPU_bench_count( name, "packets", packets, NULL );
+                HGPU_bench_count( name, "packets moved", counters[1], NULL );
+            }
+            else
+            {
+                if( event_produce ) clReleaseEvent( event_produce );
+                if( event_consume ) clReleaseEvent( event_consume );
+            }
+        }
+        else
+            HGPU_bench_error( CLerr, name );
+        if( produce ) clReleaseKernel( produce );
+        if( consume ) clReleaseKernel( consume );
+        if( pipe    ) clReleaseMemObject( pipe );
+        clReleaseProgram( program );
+    }
+
+#endif
+
+    void
+    HGPU_bench_enqueue( HGPU_bench_env& env, int device_opencl_c_version )
+    {
+        HGPU_bench_title( "enqueue", "device-side enqueue and pipes (OpenCL 2.0)" );
+#if defined( CL_VERSION_2_0 )
+        if( device_opencl_c_version < HGPU_OPENCL_2_0 )
+        {
+            HGPU_bench_string( "device-side enqueue", "skipped, OpenCL C 2.0 is not supported" );
+            return;
+        }
+
+        cl_int CLerr = CL_SUCCESS;
+        cl_mem counter = clCreateBuffer( env.context, CL_MEM_READ_WRITE, 2 * sizeof(cl_uint), NULL, &CLerr );
+        if( HGPU_bench_error( CLerr, "clCreateBuffer" ) )
+            return;
+
+        cl_uint max_device_queues = 0;
+        CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_ON_DEVICE_QUEUES, sizeof(max_device_queues), &max_device_queues, NULL );
+        if( ( CLerr == CL_SUCCESS ) && max_device_queues )
+            HGPU_bench_enqueue_launches( env, counter );
+        else
+            HGPU_bench_string( "device-side enqueue", "skipped, no on-device queues" );
+
+        cl_uint  pipe_max_packet       = 0;
+        cl_uint  pipe_max_reservations = 0;
+        cl_ulong max_alloc             = 0;
+        CLerr = clGetDeviceInfo( env.device, CL_DEVICE_PIPE_MAX_PACKET_SIZE, sizeof(pipe_max_packet), &pipe_max_packet, NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_PIPE_MAX_ACTIVE_RESERVATIONS, sizeof(pipe_max_reservations), &pipe_max_reservations, NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(max_alloc), &max_alloc, NULL );
+        for( size_t p = 0; !HGPU_bench_error( CLerr, "pipes" ) && ( p < sizeof(HGPU_bench_packets) / sizeof(HGPU_bench_packets[0]) ); p++ )
+        {
+            const HGPU_bench_packet& packet = HGPU_bench_packets[p];
+            if( packet.size > pipe_max_packet )
+                continue;
+            cl_uint packets = HGPU_BENCH_PIPE_PACKETS;
+            while( (cl_ulong) packets * packet.size > max_alloc / 2 )
+                packets /= 2;
+            for( size_t r = 0; r < sizeof(HGPU_bench_reservations) / sizeof(HGPU_bench_reservations[0]); r++ )
+            {
+                cl_uint reservation = HGPU_bench_reservations[r];
+                if( ( reservation > pipe_max_reservations ) || ( reservation > packets ) )
+                {
+                    char name[64];
+                    sprintf( name, "pipe %u B packets, reserve %u", packet.size, reservation );
+                    HGPU_bench_string( name, "skipped, exceeds %s (%u)",
+                                       ( ( reservation > pipe_max_reservations ) ? "CL_DEVICE_PIPE_MAX_ACTIVE_RESERVATIONS" : "pipe capacity" ),
+                                       ( ( reservation > pipe_max_reservations ) ? pipe_max_reservations : packets ) );
+                    continue;
+                }
+                HGPU_bench_enqueue_pipe( env, counter, packet, reservation, packets );
+            }
+        }
+        clReleaseMemObject( counter );
+#else
+        (void) env;
+        (void) device_opencl_c_version;
+        HGPU_bench_string( "device-side enqueue", "skipped, built without OpenCL 2.0 headers" );
+#endif
+    }
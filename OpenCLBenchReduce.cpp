@@ -0,0 +1,572 @@
+/******************************************************************************
+ * @file     OpenCLBenchReduce.cpp
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Parallel reduction and prefix scan strategies benchmark
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <vector>
+
+#ifndef _WIN32
+#include <cstring>
+#endif
+
+#include "OpenCLInfo.h"
+#include "OpenCLOutput.h"
+#include "OpenCLBench.h"
+
+
+#define HGPU_BENCH_REDUCE_MIN_ELEMENTS  (1 << 20)
+#define HGPU_BENCH_REDUCE_MAX_ELEMENTS  (1 << 30)
+#define HGPU_BENCH_REDUCE_SIZE_STEP     4           // elements multiplier between tested sizes
+#define HGPU_BENCH_REDUCE_WORK_GROUP    256         // upper limit of work-group size
+#define HGPU_BENCH_REDUCE_GROUPS_PER_CU 16          // first pass reduction work-groups per compute unit
+#define HGPU_BENCH_REDUCE_ITEMS         4           // scan elements per work-item
+#define HGPU_BENCH_REDUCE_REPEATS       3
+
+#define HGPU_BENCH_STRATEGY_TREE        0
+#define HGPU_BENCH_STRATEGY_WARP        1
+#define HGPU_BENCH_STRATEGY_WORK_GROUP  2
+#define HGPU_BENCH_STRATEGY_SUB_GROUP   3
+#define HGPU_BENCH_STRATEGIES           4
+
+#define HGPU_BENCH_OP_REDUCE            0
+#define HGPU_BENCH_OP_SCAN              1
+#define HGPU_BENCH_OPS                  2
+
+// STRATEGY selects work-group reduce/scan implementation; WG, WARP and ITEMS are set at build time.
+// Input is a[i] = i & 3, so results are checked against closed-form sums.
+static const char* HGPU_bench_reduce_source =
+    "#if defined( SUBGROUP_KHR )\n"
+    "#pragma OPENCL EXTENSION cl_khr_subgroups : enable\n"
+    "#elif defined( SUBGROUP_INTEL )\n"
+    "#pragma OPENCL EXTENSION cl_intel_subgroups : enable\n"
+    "#endif\n"
+    "\n"
+    "uint wg_reduce( uint v, local uint* scratch )\n"
+    "{\n"
+    "    uint lid = get_local_id( 0 );\n"
+    "#if ( STRATEGY == 0 )\n"
+    "    scratch[lid] = v;\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    for( uint s = WG / 2; s > 0; s >>= 1 )\n"
+    "    {\n"
+    "        if( lid < s ) scratch[lid] += scratch[lid + s];\n"
+    "        barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    }\n"
+    "    return scratch[0];\n"
+    "#elif ( STRATEGY == 1 )\n"
+    "    scratch[lid] = v;\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    for( uint s = WG / 2; s > WARP; s >>= 1 )\n"
+    "    {\n"
+    "        if( lid < s ) scratch[lid] += scratch[lid + s];\n"
+    "        barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    }\n"
+    "    if( lid < WARP )\n"
+    "    {\n"
+    "        volatile local uint* vs = scratch;\n"
+    "        #pragma unroll\n"
+    "        for( uint s = WARP; s > 0; s >>= 1 )\n"
+    "            vs[lid] += vs[lid + s];\n"
+    "    }\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    return scratch[0];\n"
+    "#elif ( STRATEGY == 2 )\n"
+    "    return work_group_reduce_add( v );\n"
+    "#else\n"
+    "    uint s = sub_group_reduce_add( v );\n"
+    "    if( get_sub_group_local_id() == 0 ) scratch[get_sub_group_id()] = s;\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    if( lid == 0 )\n"
+    "    {\n"
+    "        for( uint i = 1; i < get_num_sub_groups(); i++ ) s += scratch[i];\n"
+    "        scratch[WG] = s;\n"
+    "    }\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    return scratch[WG];\n"
+    "#endif\n"
+    "}\n"
+    "\n"
+    "uint wg_scan_inclusive( uint v, local uint* scratch )\n"
+    "{\n"
+    "    uint lid = get_local_id( 0 );\n"
+    "#if ( STRATEGY == 0 )\n"
+    "    scratch[lid] = v;\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    for( uint offset = 1; offset < WG; offset <<= 1 )\n"
+    "    {\n"
+    "        uint t = ( lid >= offset ) ? scratch[lid - offset] : 0;\n"
+    "        barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "        scratch[lid] += t;\n"
+    "        barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    }\n"
+    "    return scratch[lid];\n"
+    "#elif ( STRATEGY == 1 )\n"
+    "    volatile local uint* vs = scratch;\n"
+    "    local uint* totals = scratch + WG;\n"
+    "    uint lane = lid & ( WARP - 1 );\n"
+    "    uint warp = lid / WARP;\n"
+    "    vs[lid] = v;\n"
+    "    #pragma unroll\n"
+    "    for( uint offset = 1; offset < WARP; offset <<= 1 )\n"
+    "        if( lane >= offset ) vs[lid] += vs[lid - offset];\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    if( lane == WARP - 1 ) totals[warp] = vs[lid];\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    if( lid < WG / WARP )\n"
+    "    {\n"
+    "        volatile local uint* vt = totals;\n"
+    "        #pragma unroll\n"
+    "        for( uint offset = 1; offset < WG / WARP; offset <<= 1 )\n"
+    "            if( lid >= offset ) vt[lid] += vt[lid - offset];\n"
+    "    }\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    return vs[lid] + ( warp ? totals[warp - 1] : 0 );\n"
+    "#elif ( STRATEGY == 2 )\n"
+    "    return work_group_scan_inclusive_add( v );\n"
+    "#else\n"
+    "    uint s = sub_group_scan_inclusive_add( v );\n"
+    "    if( get_sub_group_local_id() == get_sub_group_size() - 1 ) scratch[get_sub_group_id()] = s;\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    if( lid == 0 )\n"
+    "        for( uint i = 1; i < get_num_sub_groups(); i++ ) scratch[i] += scratch[i - 1];\n"
+    "    barrier( CLK_LOCAL_MEM_FENCE );\n"
+    "    return s + ( get_sub_group_id() ? scratch[get_sub_group_id() - 1] : 0 );\n"
+    "#endif\n"
+    "}\n"
+    "\n"
+    "kernel void init( global uint* a )\n"
+    "{\n"
+    "    a[get_global_id( 0 )] = get_global_id( 0 ) & 3;\n"
+    "}\n"
+    "\n"
+    "kernel __attribute__(( reqd_work_group_size( WG, 1, 1 ) ))\n"
+    "void reduce( global const uint* in, global uint* partial, uint n )\n"
+    "{\n"
+    "    local uint scratch[2 * WG + 1];\n"
+    "    uint acc = 0;\n"
+    "    for( uint i = get_global_id( 0 ); i < n; i += get_global_size( 0 ) )\n"
+    "        acc += in[i];\n"
+    "    acc = wg_reduce( acc, scratch );\n"
+    "    if( get_local_id( 0 ) == 0 ) partial[get_group_id( 0 )] = acc;\n"
+    "}\n"
+    "\n"
+    "kernel __attribute__(( reqd_work_group_size( WG, 1, 1 ) ))\n"
+    "void scan_blocks( global const uint* in, global uint* out, global uint* sums, uint n )\n"
+    "{\n"
+    "    local uint scratch[2 * WG + 1];\n"
+    "    uint lid  = get_local_id( 0 );\n"
+    "    uint base = get_global_id( 0 ) * ITEMS;\n"
+    "    uint v[ITEMS];\n"
+    "    uint acc  = 0;\n"
+    "    for( uint k = 0; k < ITEMS; k++ )\n"
+    "    {\n"
+    "        acc += ( base + k < n ) ? in[base + k] : 0;\n"
+    "        v[k] = acc;\n"
+    "    }\n"
+    "    uint prefix = wg_scan_inclusive( acc, scratch ) - acc;\n"
+    "    for( uint k = 0; k < ITEMS; k++ )\n"
+    "        if( base + k < n ) out[base + k] = v[k] + prefix;\n"
+    "    if( lid == WG - 1 ) sums[get_group_id( 0 )] = prefix + acc;\n"
+    "}\n"
+    "\n"
+    "kernel void scan_add( global uint* out, global const uint* sums, uint n )\n"
+    "{\n"
+    "    uint i     = get_global_id( 0 );\n"
+    "    uint block = i / ( WG * ITEMS );\n"
+    "    if( block && ( i < n ) ) out[i] += sums[block - 1];\n"
+    "}\n";
+
+static const char* HGPU_bench_strategy_names[HGPU_BENCH_STRATEGIES] = { "tree", "warp-sync", "work_group", "sub_group" };
+static const char* HGPU_bench_op_names[HGPU_BENCH_OPS]              = { "reduce", "scan" };
+
+    struct HGPU_bench_reduce_kernels
+    {
+        cl_program program;
+        cl_kernel  init;
+        cl_kernel  reduce;
+        cl_kernel  scan_blocks;
+        cl_kernel  scan_add;
+    };
+
+    static bool
+    HGPU_bench_has_extension( cl_device_id device, const char* extension_name )
+    {
+        size_t extensions_size = 0;
+        if( ( clGetDeviceInfo( device, CL_DEVICE_EXTENSIONS, 0, NULL, &extensions_size ) != CL_SUCCESS ) || !extensions_size )
+            return false;
+        std::vector<char> extensions( extensions_size + 1, 0 );
+        if( clGetDeviceInfo( device, CL_DEVICE_EXTENSIONS, extensions_size, &extensions[0], NULL ) != CL_SUCCESS )
+            return false;
+        // CL_DEVICE_EXTENSIONS is a space-separated list; only whole names match
+        size_t length = strlen( extension_name );
+        for( const char* found = strstr( &extensions[0], extension_name ); found; found = strstr( found + 1, extension_name ) )
+            if( ( ( found == &extensions[0] ) || ( found[-1] == ' ' ) ) && ( ( found[length] == ' ' ) || ( found[length] == 0 ) ) )
+                return true;
+        return false;
+    }
+
+    static cl_uint
+    HGPU_bench_warp_width( cl_device_id device )
+    {
+        cl_uint warp_width = 0;
+#if defined( CL_DEVICE_WARP_SIZE_NV )
+        if( clGetDeviceInfo( device, CL_DEVICE_WARP_SIZE_NV, sizeof(warp_width), &warp_width, NULL ) == CL_SUCCESS )
+            return warp_width;
+#endif
+#if defined( CL_DEVICE_WAVEFRONT_WIDTH_AMD )
+        if( clGetDeviceInfo( device, CL_DEVICE_WAVEFRONT_WIDTH_AMD, sizeof(warp_width), &warp_width, NULL ) == CL_SUCCESS )
+            return warp_width;
+#endif
+        (void) device;
+        return 0;
+    }
+
+    static void
+    HGPU_bench_reduce_release( HGPU_bench_reduce_kernels& kernels )
+    {
+        if( kernels.init        ) clReleaseKernel( kernels.init );
+        if( kernels.reduce      ) clReleaseKernel( kernels.reduce );
+        if( kernels.scan_blocks ) clReleaseKernel( kernels.scan_blocks );
+        if( kernels.scan_add    ) clReleaseKernel( kernels.scan_add );
+        if( kernels.program     ) clReleaseProgram( kernels.program );
+        memset( &kernels, 0, sizeof(kernels) );
+    }
+
+    static bool
+    HGPU_bench_reduce_build( HGPU_bench_env& env, int strategy, const char* options, HGPU_bench_reduce_kernels& kernels )
+    {
+        cl_int CLerr = CL_SUCCESS;
+        memset( &kernels, 0, sizeof(kernels) );
+        kernels.program = HGPU_bench_program_build( env, HGPU_bench_reduce_source, options );
+        if( !kernels.program )
+            return false;
+        kernels.init = clCreateKernel( kernels.program, "init", &CLerr );
+        if( CLerr == CL_SUCCESS )
+            kernels.reduce = clCreateKernel( kernels.program, "reduce", &CLerr );
+        if( CLerr == CL_SUCCESS )
+            kernels.scan_blocks = clCreateKernel( kernels.program, "scan_blocks", &CLerr );
+        if( CLerr == CL_SUCCESS )
+            kernels.scan_add = clCreateKernel( kernels.program, "scan_add", &CLerr );
+        if( CLerr != CL_SUCCESS )
+        {
+            HGPU_bench_error( CLerr, HGPU_bench_strategy_names[strategy] );
+            HGPU_bench_reduce_release( kernels );
+            return false;
+        }
+        return true;
+    }
+
+    static cl_int
+    HGPU_bench_reduce_launch( HGPU_bench_env& env, cl_kernel kernel, size_t global_size, size_t local_size, double& time_total )
+    {
+        cl_event event = NULL;
+        cl_int CLerr = clEnqueueNDRangeKernel( env.queue, kernel, 1, NULL, &global_size, ( local_size ? &local_size : NULL ), 0, NULL, &event );
+        if( CLerr == CL_SUCCESS )
+            time_total += HGPU_bench_event_time( event );
+        return CLerr;
+    }
+
+    // sum of ( i & 3 ) for i in [0, n), modulo 2^32
+    static cl_uint
+    HGPU_bench_reduce_expected( cl_ulong n )
+    {
+        cl_ulong r = n & 3;
+        return (cl_uint) ( ( n / 4 ) * 6 + r * ( r - 1 ) / 2 );
+    }
+
+    // two-pass reduction: per-group partial sums, then one work-group over partials; returns seconds or negative on error
+    static double
+    HGPU_bench_reduce_run( HGPU_bench_env& env, HGPU_bench_reduce_kernels& kernels, cl_mem in, cl_mem partial, cl_uint n, size_t groups, size_t work_group )
+    {
+        double  time_best = -1.0;
+        cl_uint n_partial = (cl_uint) groups;
+        cl_uint result    = 0;
+        for( int r = 0; r <= HGPU_BENCH_REDUCE_REPEATS; r++ )
+        {
+            double time_total = 0.0;
+            cl_int CLerr = clSetKernelArg( kernels.reduce, 0, sizeof(in), &in );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clSetKernelArg( kernels.reduce, 1, sizeof(partial), &partial );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clSetKernelArg( kernels.reduce, 2, sizeof(n), &n );
+            if( CLerr == CL_SUCCESS )
+                CLerr = HGPU_bench_reduce_launch( env, kernels.reduce, groups * work_group, work_group, time_total );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clSetKernelArg( kernels.reduce, 0, sizeof(partial), &partial );
+            if( CLerr == CL_SUCCESS )
+                CLerr = clSetKernelArg( kernels.reduce, 2, sizeof(n_partial), &n_partial );
+            if( CLerr == CL_SUCCESS )
+                CLerr = HGPU_bench_reduce_launch( env, kernels.reduce, work_group, work_group, time_total );
+            if( CLerr != CL_SUCCESS )
+                return -1.0;
+            if( r && ( ( time_best < 0.0 ) || ( time_total < time_best ) ) )
+                time_best = time_total;
+        }
+        if( clEnqueueReadBuffer( env.queue, partial, CL_TRUE, 0, sizeof(result), &result, 0, NULL, NULL ) != CL_SUCCESS )
+            return -1.0;
+        return ( result == HGPU_bench_reduce_expected( n ) ) ? time_best : -2.0;
+    }
+
+    // scan of blocks, recursive scan of block sums, then block offsets are added; returns seconds or negative on error
+    static double
+    HGPU_bench_scan_run( HGPU_bench_env& env, HGPU_bench_reduce_kernels& kernels, cl_mem in, cl_mem out, std::vector<cl_mem>& sums, cl_uint n, size_t work_group )
+    {
+        double time_best = -1.0;
+        size_t block     = work_group * HGPU_BENCH_REDUCE_ITEMS;
+        for( int r = 0; r <= HGPU_BENCH_REDUCE_REPEATS; r++ )
+        {
+            double  time_total = 0.0;
+            cl_int  CLerr      = CL_SUCCESS;
+            cl_mem  level_in   = in;
+            cl_mem  level_out  = out;
+            cl_uint level_n    = n;
+            std::vector<cl_uint> levels;
+            for( size_t l = 0; ( CLerr == CL_SUCCESS ) && ( l < sums.size() ); l++ )
+            {
+                size_t blocks = ( level_n + block - 1 ) / block;
+                CLerr = clSetKernelArg( kernels.scan_blocks, 0, sizeof(level_in), &level_in );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clSetKernelArg( kernels.scan_blocks, 1, sizeof(level_out), &level_out );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clSetKernelArg( kernels.scan_blocks, 2, sizeof(sums[l]), &sums[l] );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clSetKernelArg( kernels.scan_blocks, 3, sizeof(level_n), &level_n );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = HGPU_bench_reduce_launch( env, kernels.scan_blocks, blocks * work_group, work_group, time_total );
+                levels.push_back( level_n );
+                if( blocks == 1 )
+                    break;
+                level_in  = sums[l];
+                level_out = sums[l];
+                level_n   = (cl_uint) blocks;
+            }
+            for( size_t l = levels.size() - 1; ( CLerr == CL_SUCCESS ) && ( l > 0 ); l-- )
+            {
+                cl_mem level_data = ( l == 1 ) ? out : sums[l - 2];
+                CLerr = clSetKernelArg( kernels.scan_add, 0, sizeof(level_data), &level_data );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clSetKernelArg( kernels.scan_add, 1, sizeof(sums[l - 1]), &sums[l - 1] );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clSetKernelArg( kernels.scan_add, 2, sizeof(cl_uint), &levels[l - 1] );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = HGPU_bench_reduce_launch( env, kernels.scan_add, ( levels[l - 1] + work_group - 1 ) / work_group * work_group, work_group, time_total );
+            }
+            if( CLerr != CL_SUCCESS )
+                return -1.0;
+            if( r && ( ( time_best < 0.0 ) || ( time_total < time_best ) ) )
+                time_best = time_total;
+        }
+
+        // inclusive scan: out[i] == sum of a[0..i]
+        cl_uint check_index[3] = { (cl_uint) ( block - 1 ), n / 3, n - 1 };
+        for( int c = 0; c < 3; c++ )
+        {
+            cl_uint result = 0;
+            if( clEnqueueReadBuffer( env.queue, out, CL_TRUE, check_index[c] * sizeof(cl_uint), sizeof(result), &result, 0, NULL, NULL ) != CL_SUCCESS )
+                return -1.0;
+            if( result != HGPU_bench_reduce_expected( (cl_ulong) check_index[c] + 1 ) )
+                return -2.0;
+        }
+        return time_best;
+    }
+
+    void
+    HGPU_bench_reduce( HGPU_bench_env& env, int device_opencl_c_version )
+    {
+        HGPU_bench_title( "reduce", "parallel reduction and prefix scan strategies" );
+
+        size_t   max_work_group = 0;
+        cl_uint  compute_units  = 0;
+        cl_ulong max_alloc      = 0;
+        cl_ulong global_mem     = 0;
+        cl_int   CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(max_work_group), &max_work_group, NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_COMPUTE_UNITS,  sizeof(compute_units), &compute_units, NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(max_alloc),     &max_alloc,     NULL );
+        if( CLerr == CL_SUCCESS )
+            CLerr = clGetDeviceInfo( env.device, CL_DEVICE_GLOBAL_MEM_SIZE,    sizeof(global_mem),    &global_mem,    NULL );
+        if( HGPU_bench_error( CLerr, "clGetDeviceInfo" ) )
+            return;
+
+        size_t work_group = HGPU_BENCH_REDUCE_WORK_GROUP;
+        while( work_group > max_work_group )
+            work_group /= 2;
+        cl_uint warp_width = HGPU_bench_warp_width( env.device );
+
+        // strategy availability and build options
+        char options[HGPU_BENCH_STRATEGIES][256];
+        bool available[HGPU_BENCH_STRATEGIES];
+        for( int s = 0; s < HGPU_BENCH_STRATEGIES; s++ )
+        {
+            available[s] = true;
+            sprintf( options[s], "-DSTRATEGY=%i -DWG=%u -DWARP=%u -DITEMS=%u", s, (unsigned int) work_group, ( warp_width ? warp_width : 1 ), HGPU_BENCH_REDUCE_ITEMS );
+        }
+        if( !warp_width || ( work_group < 2 * warp_width ) || ( work_group > warp_width * warp_width ) )
+        {
+            available[HGPU_BENCH_STRATEGY_WARP] = false;
+            HGPU_bench_string( HGPU_bench_strategy_names[HGPU_BENCH_STRATEGY_WARP], "skipped, %s",
+                               ( warp_width ? "work-group size does not fit warp width" : "warp/wavefront width is not reported" ) );
+        }
+        if( device_opencl_c_version >= HGPU_OPENCL_2_0 )
+            strcat( options[HGPU_BENCH_STRATEGY_WORK_GROUP], " -cl-std=CL2.0" );
+        else
+        {
+            available[HGPU_BENCH_STRATEGY_WORK_GROUP] = false;
+            HGPU_bench_string( HGPU_bench_strategy_names[HGPU_BENCH_STRATEGY_WORK_GROUP], "skipped, OpenCL C 2.0 is not supported" );
+        }
+        if( HGPU_bench_has_extension( env.device, "cl_khr_subgroups" ) )
+            strcat( options[HGPU_BENCH_STRATEGY_SUB_GROUP], ( device_opencl_c_version >= HGPU_OPENCL_2_0 ) ? " -DSUBGROUP_KHR -cl-std=CL2.0" : " -DSUBGROUP_KHR" );
+        else if( HGPU_bench_has_extension( env.device, "cl_intel_subgroups" ) )
+            strcat( options[HGPU_BENCH_STRATEGY_SUB_GROUP], " -DSUBGROUP_INTEL" );
+        else
+        {
+            available[HGPU_BENCH_STRATEGY_SUB_GROUP] = false;
+            HGPU_bench_string( HGPU_bench_strategy_names[HGPU_BENCH_STRATEGY_SUB_GROUP], "skipped, no cl_khr_subgroups/cl_intel_subgroups" );
+        }
+
+        HGPU_bench_reduce_kernels kernels[HGPU_BENCH_STRATEGIES];
+        memset( kernels, 0, sizeof(kernels) );
+        for( int s = 0; s < HGPU_BENCH_STRATEGIES; s++ )
+            if( available[s] )
+                available[s] = HGPU_bench_reduce_build( env, s, options[s], kernels[s] );
+        if( !available[HGPU_BENCH_STRATEGY_TREE] )
+        {
+            for( int s = 0; s < HGPU_BENCH_STRATEGIES; s++ )
+                HGPU_bench_reduce_release( kernels[s] );
+            return;
+        }
+
+        size_t groups = ( compute_units ? compute_units : 1 ) * HGPU_BENCH_REDUCE_GROUPS_PER_CU;
+        int    best_strategy[HGPU_BENCH_OPS] = { -1, -1 };
+        cl_uint best_size[HGPU_BENCH_OPS]    = { 0, 0 };
+        for( cl_ulong n = HGPU_BENCH_REDUCE_MIN_ELEMENTS; n <= HGPU_BENCH_REDUCE_MAX_ELEMENTS; n *= HGPU_BENCH_REDUCE_SIZE_STEP )
+        {
+            char   name[64];
+            size_t bytes = (size_t) n * sizeof(cl_uint);
+            sprintf( name, "%u M elements", (unsigned int) ( n >> 20 ) );
+            if( ( bytes > max_alloc ) || ( 2 * (cl_ulong) bytes > global_mem / 4 * 3 ) )
+            {
+                HGPU_bench_string( name, "skipped, exceeds device memory" );
+                break;
+            }
+
+            cl_mem in      = clCreateBuffer( env.context, CL_MEM_READ_WRITE, bytes, NULL, &CLerr );
+            cl_mem out     = NULL;
+            cl_mem partial = NULL;
+            if( CLerr == CL_SUCCESS )
+                out = clCreateBuffer( env.context, CL_MEM_READ_WRITE, bytes, NULL, &CLerr );
+            if( CLerr == CL_SUCCESS )
+                partial = clCreateBuffer( env.context, CL_MEM_READ_WRITE, groups * sizeof(cl_uint), NULL, &CLerr );
+            std::vector<cl_mem> sums;
+            for( cl_ulong level_n = n; ( CLerr == CL_SUCCESS ) && ( level_n > 1 ); )
+            {
+                level_n = ( level_n + work_group * HGPU_BENCH_REDUCE_ITEMS - 1 ) / ( work_group * HGPU_BENCH_REDUCE_ITEMS );
+                sums.push_back( clCreateBuffer( env.context, CL_MEM_READ_WRITE, level_n * sizeof(cl_uint), NULL, &CLerr ) );
+            }
+            if( CLerr == CL_SUCCESS )
+            {
+                size_t init_size = (size_t) n;
+                CLerr = clSetKernelArg( kernels[HGPU_BENCH_STRATEGY_TREE].init, 0, sizeof(in), &in );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clEnqueueNDRangeKernel( env.queue, kernels[HGPU_BENCH_STRATEGY_TREE].init, 1, NULL, &init_size, NULL, 0, NULL, NULL );
+                if( CLerr == CL_SUCCESS )
+                    CLerr = clFinish( env.queue );
+            }
+            if( !HGPU_bench_error( CLerr, name ) )
+            {
+                for( int op = 0; op < HGPU_BENCH_OPS; op++ )
+                {
+                    double best_rate = 0.0;
+                    int    best      = -1;
+                    char   row_name[128], row[256] = "";
+                    sprintf( row_name, "%s, %s", HGPU_bench_op_names[op], name );
+                    for( int s = 0; s < HGPU_BENCH_STRATEGIES; s++ )
+                    {
+                        if( !available[s] )
+                            continue;
+                        double time_run = ( op == HGPU_BENCH_OP_REDUCE ) ?
+                                              HGPU_bench_reduce_run( env, kernels[s], in, partial, (cl_uint) n, groups, work_group ) :
+                                              HGPU_bench_scan_run( env, kernels[s], in, out, sums, (cl_uint) n, work_group );
+                        if( time_run == -2.0 )
+                        {
+                            sprintf( row + strlen( row ), "%s wrong result, ", HGPU_bench_strategy_names[s] );
+                            HGPU_bench_note( row_name, HGPU_bench_strategy_names[s], "wrong result" );
+                            continue;
+                        }
+                        if( time_run <= 0.0 )
+                        {
+                            sprintf( row + strlen( row ), "%s -, ", HGPU_bench_strategy_names[s] );
+                            continue;
+                        }
+                        // bytes moved: reduce reads input once, scan reads input and writes output
+                        double rate = (double) bytes * ( ( op == HGPU_BENCH_OP_REDUCE ) ? 1 : 2 ) / time_run * 1e-9;
+                        sprintf( row + strlen( row ), "%s %.2f GB/s, ", HGPU_bench_strategy_names[s], rate );
+                        HGPU_bench_value( row_name, HGPU_bench_strategy_names[s], rate, HGPU_OUTPUT_UNIT_GBPS );
+                        if( rate > best_rate )
+                        {
+                            best_rate = rate;
+                            best      = s;
+                        }
+                    }
+                    HGPU_bench_row( row_name, "%sbest %s", row, ( best < 0 ) ? "-" : HGPU_bench_strategy_names[best] );
+                    if( best >= 0 )
+                    {
+                        HGPU_bench_note( row_name, "best", HGPU_bench_strategy_names[best] );
+                        best_strategy[op] = best;
+                        best_size[op]     = (cl_uint) ( n >> 20 );
+                    }
+                }
+            }
+            for( size_t l = 0; l < sums.size(); l++ )
+                if( sums[l] ) clReleaseMemObject( sums[l] );
+            if( partial ) clReleaseMemObject( partial );
+            if( out     ) clReleaseMemObject( out );
+            if( in      ) clReleaseMemObject( in );
+        }
+
+        // best strategy is the fastest one at the largest tested size
+        for( int op = 0; op < HGPU_BENCH_OPS; op++ )
+            if( best_strategy[op] >= 0 )
+            {
+                char name[64];
+                sprintf( name, "best %s strategy", HGPU_bench_op_names[op] );
+                HGPU_bench_string( name, "%s (at %u M elements)", HGPU_bench_strategy_names[best_strategy[op]], best_size[op] );
+            }
+
+        for( int s = 0; s < HGPU_BENCH_STRATEGIES; s++ )
+            HGPU_bench_reduce_release( kernels[s] );
+    }
@@ -0,0 +1,496 @@
+/******************************************************************************
+ * @file     OpenCLCapture.cpp
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Record/replay layer for OpenCL platform and device queries
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+// Capture file format (text, one record per line; parameter names and value bytes
+// in hex, error codes, indices, counts and sizes in decimal):
+//     OpenCLInfo capture 1
+//     P  <err> <platforms>                            - clGetPlatformIDs
+//     PI <platform> <param> <err> <size> <bytes|->    - clGetPlatformInfo
+//     D  <platform> <err> <devices>                   - clGetDeviceIDs( CL_DEVICE_TYPE_ALL )
+//     DI <platform> <device> <param> <err> <size> <bytes|->  - clGetDeviceInfo
+// Every query is recorded with its full value, so replay answers size queries,
+// short buffers and error codes exactly as the driver did.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <map>
+
+#ifndef _WIN32
+#include <cstring>
+#endif
+
+#include "OpenCLCapture.h"
+
+
+    struct HGPU_capture_entry
+    {
+        cl_int err;
+        std::vector<unsigned char> value;
+    };
+
+    typedef std::map<cl_uint, HGPU_capture_entry> HGPU_capture_info;
+
+    struct HGPU_capture_device
+    {
+        cl_device_id      id;
+        HGPU_capture_info info;
+    };
+
+    struct HGPU_capture_platform
+    {
+        cl_platform_id    id;
+        HGPU_capture_info info;
+        cl_int            devices_err;
+        bool              devices_loaded;
+        std::vector<HGPU_capture_device> devices;
+    };
+
+    static int         HGPU_capture_current_mode = HGPU_CAPTURE_MODE_LIVE;
+    static std::string HGPU_capture_file;
+    static cl_int      HGPU_capture_platforms_err    = CL_SUCCESS;
+    static bool        HGPU_capture_platforms_loaded = false;
+    static std::vector<HGPU_capture_platform> HGPU_capture_platforms;
+
+
+    static void
+    HGPU_capture_error( const char* error_message, const char* file_name )
+    {
+        printf( "ERROR: (%s: %s)\n", error_message, file_name );
+        exit( 1 );
+    }
+
+    static cl_int
+    HGPU_capture_serve( const HGPU_capture_entry& entry, size_t param_value_size, void* param_value, size_t* param_value_size_ret )
+    {
+        if( entry.err != CL_SUCCESS )
+            return entry.err;
+        if( param_value )
+        {
+            if( param_value_size < entry.value.size() )
+                return CL_INVALID_VALUE;
+            if( entry.value.size() )
+                memcpy( param_value, &entry.value[0], entry.value.size() );
+        }
+        if( param_value_size_ret )
+            *param_value_size_ret = entry.value.size();
+        return CL_SUCCESS;
+    }
+
+    static HGPU_capture_platform*
+    HGPU_capture_find_platform( cl_platform_id platform )
+    {
+        for( size_t i = 0; i < HGPU_capture_platforms.size(); i++ )
+            if( HGPU_capture_platforms[i].id == platform )
+                return &HGPU_capture_platforms[i];
+        return NULL;
+    }
+
+    static HGPU_capture_device*
+    HGPU_capture_find_device( cl_device_id device )
+    {
+        for( size_t i = 0; i < HGPU_capture_platforms.size(); i++ )
+            for( size_t j = 0; j < HGPU_capture_platforms[i].devices.size(); j++ )
+                if( HGPU_capture_platforms[i].devices[j].id == device )
+                    return &HGPU_capture_platforms[i].devices[j];
+        return NULL;
+    }
+
+// ------------------------------------------------------------- recording
+#ifndef HGPU_REPLAY_ONLY
+
+    static void
+    HGPU_capture_record_platform_info( HGPU_capture_platform& platform, cl_platform_info param_name )
+    {
+        HGPU_capture_entry& entry = platform.info[param_name];
+        size_t size = 0;
+        entry.value.clear();
+        entry.err = clGetPlatformInfo( platform.id, param_name, 0, NULL, &size );
+        if( ( entry.err == CL_SUCCESS ) && size )
+        {
+            entry.value.resize( size );
+            entry.err = clGetPlatformInfo( platform.id, param_name, size, &entry.value[0], NULL );
+            if( entry.err != CL_SUCCESS ) entry.value.clear();
+        }
+    }
+
+    static void
+    HGPU_capture_record_device_info( HGPU_capture_device& device, cl_device_info param_name )
+    {
+        HGPU_capture_entry& entry = device.info[param_name];
+        size_t size = 0;
+        entry.value.clear();
+        entry.err = clGetDeviceInfo( device.id, param_name, 0, NULL, &size );
+        if( ( entry.err == CL_SUCCESS ) && size )
+        {
+            entry.value.resize( size );
+            entry.err = clGetDeviceInfo( device.id, param_name, size, &entry.value[0], NULL );
+            if( entry.err != CL_SUCCESS ) entry.value.clear();
+        }
+    }
+
+    static void
+    HGPU_capture_record_platforms( void )
+    {
+        cl_uint platform_number = 0;
+        HGPU_capture_platforms_loaded = true;
+        HGPU_capture_platforms_err    = clGetPlatformIDs( 0, NULL, &platform_number );
+        if( ( HGPU_capture_platforms_err != CL_SUCCESS ) || !platform_number )
+            return;
+
+        std::vector<cl_platform_id> ids( platform_number );
+        HGPU_capture_platforms_err = clGetPlatformIDs( platform_number, &ids[0], NULL );
+        if( HGPU_capture_platforms_err != CL_SUCCESS )
+            return;
+
+        HGPU_capture_platforms.resize( platform_number );
+        for( cl_uint i = 0; i < platform_number; i++ )
+        {
+            HGPU_capture_platforms[i].id             = ids[i];
+            HGPU_capture_platforms[i].devices_err    = CL_SUCCESS;
+            HGPU_capture_platforms[i].devices_loaded = false;
+        }
+    }
+
+    static void
+    HGPU_capture_record_devices( HGPU_capture_platform& platform )
+    {
+        cl_uint devices_number = 0;
+        platform.devices_loaded = true;
+        platform.devices_err    = clGetDeviceIDs( platform.id, CL_DEVICE_TYPE_ALL, 0, NULL, &devices_number );
+        if( ( platform.devices_err != CL_SUCCESS ) || !devices_number )
+            return;
+
+        std::vector<cl_device_id> ids( devices_number );
+        platform.devices_err = clGetDeviceIDs( platform.id, CL_DEVICE_TYPE_ALL, devices_number, &ids[0], NULL );
+        if( platform.devices_err != CL_SUCCESS )
+            return;
+
+        platform.devices.resize( devices_number );
+        for( cl_uint i = 0; i < devices_number; i++ )
+        {
+            platform.devices[i].id = ids[i];
+            // needed on replay to filter clGetDeviceIDs by device type
+            HGPU_capture_record_device_info( platform.devices[i], CL_DEVICE_TYPE );
+        }
+    }
+
+#endif
+
+// ------------------------------------------------------------- capture file
+    static void
+    HGPU_capture_write_entry( FILE* stream, const HGPU_capture_entry& entry )
+    {
+        fprintf( stream, " %d %u ", (int) entry.err, (unsigned int) entry.value.size() );
+        if( entry.value.empty() )
+            fprintf( stream, "-" );
+        for( size_t i = 0; i < entry.value.size(); i++ )
+            fprintf( stream, "%02x", entry.value[i] );
+        fprintf( stream, "\n" );
+    }
+
+    static void
+    HGPU_capture_write( const char* file_name )
+    {
+        FILE* stream = fopen( file_name, "w" );
+        if( !stream )
+            HGPU_capture_error( "could not create capture file", file_name );
+
+        fprintf( stream, "%s\n", HGPU_CAPTURE_SIGNATURE );
+        fprintf( stream, "P %d %u\n", (int) HGPU_capture_platforms_err, (unsigned int) HGPU_capture_platforms.size() );
+        for( size_t i = 0; i < HGPU_capture_platforms.size(); i++ )
+        {
+            const HGPU_capture_platform& platform = HGPU_capture_platforms[i];
+            for( HGPU_capture_info::const_iterator it = platform.info.begin(); it != platform.info.end(); ++it )
+            {
+                fprintf( stream, "PI %u %#x", (unsigned int) i, (unsigned int) it->first );
+                HGPU_capture_write_entry( stream, it->second );
+            }
+            if( !platform.devices_loaded )
+                continue;
+            fprintf( stream, "D %u %d %u\n", (unsigned int) i, (int) platform.devices_err, (unsigned int) platform.devices.size() );
+            for( size_t j = 0; j < platform.devices.size(); j++ )
+                for( HGPU_capture_info::const_iterator it = platform.devices[j].info.begin(); it != platform.devices[j].info.end(); ++it )
+                {
+                    fprintf( stream, "DI %u %u %#x", (unsigned int) i, (unsigned int) j, (unsigned int) it->first );
+                    HGPU_capture_write_entry( stream, it->second );
+                }
+        }
+        fclose( stream );
+    }
+
+    static bool
+    HGPU_capture_read_entry( FILE* stream, HGPU_capture_entry& entry )
+    {
+        int          err  = 0;
+        unsigned int size = 0;
+        if( ( fscanf( stream, " %d %u ", &err, &size ) != 2 ) || ( size > HGPU_CAPTURE_ENTRY_MAX ) )
+            return false;
+        entry.err = (cl_int) err;
+        entry.value.resize( size );
+        if( !size )
+            return ( fgetc( stream ) == '-' );
+        for( unsigned int i = 0; i < size; i++ )
+        {
+            unsigned int byte = 0;
+            if( fscanf( stream, "%2x", &byte ) != 1 )
+                return false;
+            entry.value[i] = (unsigned char) byte;
+        }
+        return true;
+    }
+
+    static void
+    HGPU_capture_read( const char* file_name )
+    {
+        char         signature[256];
+        char         tag[8];
+        int          err = 0;
+        unsigned int count = 0, p = 0, d = 0, param = 0;
+
+        FILE* stream = fopen( file_name, "r" );
+        if( !stream )
+            HGPU_capture_error( "could not open capture file", file_name );
+        if( !fgets( signature, sizeof(signature), stream ) || strncmp( signature, HGPU_CAPTURE_SIGNATURE, strlen( HGPU_CAPTURE_SIGNATURE ) ) )
+            HGPU_capture_error( "wrong capture file signature", file_name );
+        if( ( fscanf( stream, " %7s %d %u", tag, &err, &count ) != 3 ) || strcmp( tag, "P" ) || ( count > HGPU_CAPTURE_PLATFORMS_MAX ) )
+            HGPU_capture_error( "wrong capture file format", file_name );
+
+        HGPU_capture_platforms_loaded = true;
+        HGPU_capture_platforms_err    = (cl_int) err;
+        HGPU_capture_platforms.resize( count );
+        for( unsigned int i = 0; i < count; i++ )
+        {
+            HGPU_capture_platforms[i].id             = (cl_platform_id) &HGPU_capture_platforms[i];
+            HGPU_capture_platforms[i].devices_err    = CL_SUCCESS;
+            HGPU_capture_platforms[i].devices_loaded = false;
+        }
+
+        while( fscanf( stream, " %7s", tag ) == 1 )
+        {
+            bool ok = false;
+            if( !strcmp( tag, "PI" ) )
+            {
+                ok = ( fscanf( stream, " %u %x", &p, &param ) == 2 ) && ( p < count );
+                ok = ok && HGPU_capture_read_entry( stream, HGPU_capture_platforms[p].info[param] );
+            }
+            else if( !strcmp( tag, "D" ) )
+            {
+                // device handles point into platform.devices, so the list is set only once
+                ok = ( fscanf( stream, " %u %d %u", &p, &err, &d ) == 3 ) && ( p < count ) && ( d <= HGPU_CAPTURE_DEVICES_MAX );
+                ok = ok && !HGPU_capture_platforms[p].devices_loaded;
+                if( ok )
+                {
+                    HGPU_capture_platform& platform = HGPU_capture_platforms[p];
+                    platform.devices_loaded = true;
+                    platform.devices_err    = (cl_int) err;
+                    platform.devices.resize( d );
+                    for( unsigned int j = 0; j < d; j++ )
+                        platform.devices[j].id = (cl_device_id) &platform.devices[j];
+                }
+            }
+            else if( !strcmp( tag, "DI" ) )
+            {
+                ok = ( fscanf( stream, " %u %u %x", &p, &d, &param ) == 3 ) && ( p < count ) && ( d < HGPU_capture_platforms[p].devices.size() );
+                ok = ok && HGPU_capture_read_entry( stream, HGPU_capture_platforms[p].devices[d].info[param] );
+            }
+            if( !ok )
+                HGPU_capture_error( "wrong capture file format", file_name );
+        }
+        fclose( stream );
+    }
+
+// ------------------------------------------------------------- mode control
+    static void
+    HGPU_capture_atexit( void )
+    {
+        HGPU_capture_close();
+    }
+
+    void
+    HGPU_capture_open( int mode, const char* file_name )
+    {
+#ifdef HGPU_REPLAY_ONLY
+        if( mode != HGPU_CAPTURE_MODE_REPLAY )
+            HGPU_capture_error( "only replay mode is available in this build", file_name );
+#endif
+        // replay hands out synthetic handles, which must never reach the driver
+        if( HGPU_capture_current_mode != HGPU_CAPTURE_MODE_LIVE )
+        {
+            HGPU_capture_current_mode = HGPU_CAPTURE_MODE_LIVE;     // nothing recorded yet, do not write a capture at exit
+            HGPU_capture_error( "only one of --record or --replay may be given", file_name );
+        }
+        HGPU_capture_current_mode = mode;
+        HGPU_capture_file         = file_name;
+        if( mode == HGPU_CAPTURE_MODE_REPLAY )
+            HGPU_capture_read( file_name );
+        if( mode == HGPU_CAPTURE_MODE_RECORD )
+            atexit( HGPU_capture_atexit ); // keep the capture when the report stops on an error
+    }
+
+    void
+    HGPU_capture_close( void )
+    {
+        if( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_RECORD )
+            HGPU_capture_write( HGPU_capture_file.c_str() );
+        HGPU_capture_current_mode = HGPU_CAPTURE_MODE_LIVE;
+    }
+
+    int
+    HGPU_capture_mode( void )
+    {
+        return HGPU_capture_current_mode;
+    }
+
+// ------------------------------------------------------------- OpenCL entry points
+    cl_int
+    HGPU_clGetPlatformIDs( cl_uint num_entries, cl_platform_id* platforms, cl_uint* num_platforms )
+    {
+#ifndef HGPU_REPLAY_ONLY
+        if( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_LIVE )
+            return clGetPlatformIDs( num_entries, platforms, num_platforms );
+        if( !HGPU_capture_platforms_loaded )
+            HGPU_capture_record_platforms();
+#endif
+        if( HGPU_capture_platforms_err != CL_SUCCESS )
+            return HGPU_capture_platforms_err;
+        if( ( !platforms && !num_platforms ) || ( platforms && !num_entries ) )
+            return CL_INVALID_VALUE;
+
+        cl_uint count = (cl_uint) HGPU_capture_platforms.size();
+        for( cl_uint i = 0; platforms && ( i < count ) && ( i < num_entries ); i++ )
+            platforms[i] = HGPU_capture_platforms[i].id;
+        if( num_platforms )
+            *num_platforms = count;
+        return CL_SUCCESS;
+    }
+
+    cl_int
+    HGPU_clGetPlatformInfo( cl_platform_id platform, cl_platform_info param_name, size_t param_value_size, void* param_value, size_t* param_value_size_ret )
+    {
+#ifndef HGPU_REPLAY_ONLY
+        if( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_LIVE )
+            return clGetPlatformInfo( platform, param_name, param_value_size, param_value, param_value_size_ret );
+#endif
+        HGPU_capture_platform* captured = HGPU_capture_find_platform( platform );
+        if( !captured )
+            return CL_INVALID_PLATFORM;
+
+        HGPU_capture_info::const_iterator it = captured->info.find( param_name );
+#ifndef HGPU_REPLAY_ONLY
+        if( ( it == captured->info.end() ) && ( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_RECORD ) )
+        {
+            HGPU_capture_record_platform_info( *captured, param_name );
+            it = captured->info.find( param_name );
+        }
+#endif
+        if( it == captured->info.end() )
+            return CL_INVALID_VALUE;
+        return HGPU_capture_serve( it->second, param_value_size, param_value, param_value_size_ret );
+    }
+
+    cl_int
+    HGPU_clGetDeviceIDs( cl_platform_id platform, cl_device_type device_type, cl_uint num_entries, cl_device_id* devices, cl_uint* num_devices )
+    {
+#ifndef HGPU_REPLAY_ONLY
+        if( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_LIVE )
+            return clGetDeviceIDs( platform, device_type, num_entries, devices, num_devices );
+#endif
+        HGPU_capture_platform* captured = HGPU_capture_find_platform( platform );
+        if( !captured )
+            return CL_INVALID_PLATFORM;
+#ifndef HGPU_REPLAY_ONLY
+        if( !captured->devices_loaded && ( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_RECORD ) )
+            HGPU_capture_record_devices( *captured );
+#endif
+        if( captured->devices_err != CL_SUCCESS )
+            return captured->devices_err;
+        if( ( !devices && !num_devices ) || ( devices && !num_entries ) )
+            return CL_INVALID_VALUE;
+
+        cl_uint count = 0;
+        for( size_t i = 0; i < captured->devices.size(); i++ )
+        {
+            if( device_type != CL_DEVICE_TYPE_ALL )
+            {
+                cl_device_type captured_type = 0;
+                if( ( HGPU_clGetDeviceInfo( captured->devices[i].id, CL_DEVICE_TYPE, sizeof(captured_type), &captured_type, NULL ) != CL_SUCCESS ) ||
+                    !( captured_type & device_type ) )
+                    continue;
+            }
+            if( devices && ( count < num_entries ) )
+                devices[count] = captured->devices[i].id;
+            count++;
+        }
+        if( !count )
+            return CL_DEVICE_NOT_FOUND;
+        if( num_devices )
+            *num_devices = count;
+        return CL_SUCCESS;
+    }
+
+    cl_int
+    HGPU_clGetDeviceInfo( cl_device_id device, cl_device_info param_name, size_t param_value_size, void* param_value, size_t* param_value_size_ret )
+    {
+#ifndef HGPU_REPLAY_ONLY
+        if( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_LIVE )
+            return clGetDeviceInfo( device, param_name, param_value_size, param_value, param_value_size_ret );
+#endif
+        HGPU_capture_device* captured = HGPU_capture_find_device( device );
+        if( !captured )
+        {
+#ifndef HGPU_REPLAY_ONLY
+            // device was not enumerated through HGPU_clGetDeviceIDs (e.g. sub-device): pass through
+            if( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_RECORD )
+                return clGetDeviceInfo( device, param_name, param_value_size, param_value, param_value_size_ret );
+#endif
+            return CL_INVALID_DEVICE;
+        }
+
+        HGPU_capture_info::const_iterator it = captured->info.find( param_name );
+#ifndef HGPU_REPLAY_ONLY
+        if( ( it == captured->info.end() ) && ( HGPU_capture_current_mode == HGPU_CAPTURE_MODE_RECORD ) )
+        {
+            HGPU_capture_record_device_info( *captured, param_name );
+            it = captured->info.find( param_name );
+        }
+#endif
+        if( it == captured->info.end() )
+            return CL_INVALID_VALUE;
+        return HGPU_capture_serve( it->second, param_value_size, param_value, param_value_size_ret );
+    }
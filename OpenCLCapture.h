@@ -0,0 +1,69 @@
+/******************************************************************************
+ * @file     OpenCLCapture.h
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Record/replay layer for OpenCL platform and device queries
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#ifndef OPENCLCAPTURE_H
+#define OPENCLCAPTURE_H
+
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#endif
+
+
+#define HGPU_CAPTURE_MODE_LIVE      0
+#define HGPU_CAPTURE_MODE_RECORD    1
+#define HGPU_CAPTURE_MODE_REPLAY    2
+
+#define HGPU_CAPTURE_SIGNATURE      "OpenCLInfo capture 1"
+#define HGPU_CAPTURE_ENTRY_MAX      65536   // largest query value accepted from a capture file, bytes
+#define HGPU_CAPTURE_PLATFORMS_MAX  256     // largest platform count accepted from a capture file
+#define HGPU_CAPTURE_DEVICES_MAX    256     // largest device count per platform accepted from a capture file
+
+    // select capture mode; RECORD writes file on HGPU_capture_close, REPLAY loads file immediately
+    void   HGPU_capture_open( int mode, const char* file_name );
+    void   HGPU_capture_close( void );
+    int    HGPU_capture_mode( void );
+
+    // same signatures as OpenCL entry points; in LIVE mode calls are forwarded to the driver
+    cl_int HGPU_clGetPlatformIDs(  cl_uint num_entries, cl_platform_id* platforms, cl_uint* num_platforms );
+    cl_int HGPU_clGetPlatformInfo( cl_platform_id platform, cl_platform_info param_name, size_t param_value_size, void* param_value, size_t* param_value_size_ret );
+    cl_int HGPU_clGetDeviceIDs(    cl_platform_id platform, cl_device_type device_type, cl_uint num_entries, cl_device_id* devices, cl_uint* num_devices );
+    cl_int HGPU_clGetDeviceInfo(   cl_device_id device, cl_device_info param_name, size_t param_value_size, void* param_value, size_t* param_value_size_ret );
+
+#endif
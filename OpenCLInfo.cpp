@@ -50,57 +50,30 @@
 #include <CL/cl_ext.h>
 #endif
 
+#include "OpenCLInfo.h"
+#include "OpenCLCapture.h"
+#include "OpenCLOutput.h"
+#ifndef HGPU_REPLAY_ONLY
+#include "OpenCLBench.h"
+#endif
 
-#define HGPU_OPENCL_VERSION_STR     "OpenCL C "
-#define HGPU_OPENCL_VERSION_1_0     HGPU_OPENCL_VERSION_STR"1.0"
-#define HGPU_OPENCL_VERSION_1_1     HGPU_OPENCL_VERSION_STR"1.1"
-#define HGPU_OPENCL_VERSION_1_2     HGPU_OPENCL_VERSION_STR"1.2"
-#define HGPU_OPENCL_VERSION_2_0     HGPU_OPENCL_VERSION_STR"2.0"
-
-#define HGPU_OPENCL_1_0             1
-#define HGPU_OPENCL_1_1             2
-#define HGPU_OPENCL_1_2             3
-#define HGPU_OPENCL_2_0             4
-
-#define HGPU_DEVICE_VENDOR_AMD      "Advanced Micro Devices"
-#define HGPU_DEVICE_VENDOR_NVIDIA   "NVIDIA"
-#define HGPU_DEVICE_VENDOR_INTEL    "Intel"
-
-#define HGPU_VENDOR_AMD             1
-#define HGPU_VENDOR_NVIDIA          2
-#define HGPU_VENDOR_INTEL           3
-
-#define HGPU_OUT_FMT_NSTR           "%-46s: "
-#define HGPU_OUT_FMT_END            "\n"
-#define HGPU_OUT_FMT_N0STR          "%s:\n"
-#define HGPU_OUT_FMT_TN             "\t%s\n"
-
-#define HGPU_OUT_FMT_STR0           HGPU_OUT_FMT_NSTR"%s"
-#define HGPU_OUT_FMT_HEX0           HGPU_OUT_FMT_NSTR"%#x"
-#define HGPU_OUT_FMT_LONGHEX0       HGPU_OUT_FMT_NSTR"%#llx"
-#define HGPU_OUT_FMT_UINT0          HGPU_OUT_FMT_NSTR"%u"
-#define HGPU_OUT_FMT_LONG0          HGPU_OUT_FMT_NSTR"%llu"
-
-#define HGPU_OUT_FMT_NSTRN          HGPU_OUT_FMT_NSTR"\n"
-#define HGPU_OUT_FMT_STR            HGPU_OUT_FMT_STR0"\n"
-#define HGPU_OUT_FMT_HEX            HGPU_OUT_FMT_HEX0"\n"
-#define HGPU_OUT_FMT_LONGHEX        HGPU_OUT_FMT_LONGHEX0"\n"
-#define HGPU_OUT_FMT_UINT           HGPU_OUT_FMT_UINT0"\n"
-#define HGPU_OUT_FMT_LONG           HGPU_OUT_FMT_LONG0"\n"
-
-#define HGPU_OUT_FMT_NONE           0
-#define HGPU_OUT_FMT_KB             1
-#define HGPU_OUT_FMT_MB             2
-#define HGPU_OUT_FMT_GB             3
-#define HGPU_OUT_FMT_MHz            4
 
+    void
+    HGPU_print_usage( const char* program_name )
+    {
+        printf( "Usage: %s [--record <file>] [--replay <file>] [--bench <name>] [--format <name>]\n", program_name );
+        printf( "\t--record <file>  save all platform/device query responses to <file>\n" );
+        printf( "\t--replay <file>  answer platform/device queries from <file> instead of OpenCL drivers\n" );
+        printf( "\t--bench <name>   run benchmark on every device: enqueue, constant, reduce, all\n" );
+        printf( "\t--format <name>  report format: text (default), json, csv, msgpack\n" );
+    }
 
     void
     HGPU_GPU_error_message( int error_code, const char* error_message )
     {
         if ( error_code != CL_SUCCESS )
         {
-            printf( "ERROR %i: (%s)\n", error_code, error_message );
+            HGPU_output_message( "ERROR %i: (%s)\n", error_code, error_message );
             exit( 1 );
         }
     }
@@ -109,44 +82,27 @@
     clGetPlatformInfoStr( cl_platform_id platform, cl_platform_info inf, const char* param_name )
     {
         char infobuf[4096];
-        cl_int CLerr = clGetPlatformInfo( platform, inf, sizeof(infobuf), infobuf, NULL );
+        cl_int CLerr = HGPU_clGetPlatformInfo( platform, inf, sizeof(infobuf), infobuf, NULL );
         if ( CLerr == CL_SUCCESS )
-            printf( HGPU_OUT_FMT_STR, param_name, infobuf );                
+            HGPU_output_str( param_name, infobuf );
     }
 
     void
     clGetDeviceInfoStr( cl_device_id device, cl_platform_info inf, const char* param_name )
     {
         char infobuf[4096];
-        cl_int CLerr = clGetDeviceInfo( device, inf, sizeof(infobuf), infobuf, NULL );
+        cl_int CLerr = HGPU_clGetDeviceInfo( device, inf, sizeof(infobuf), infobuf, NULL );
         if ( CLerr == CL_SUCCESS )
-            printf( HGPU_OUT_FMT_STR, param_name, infobuf );                
-    }
-
-    template <typename T>
-    void inline
-    clPrintAddFmt( T param, int fmt_type = HGPU_OUT_FMT_NONE )
-    {
-        switch( fmt_type )
-        {
-            case HGPU_OUT_FMT_KB:  printf( " (%5.3f KB)", ( param / 1024. ) );                 break;
-            case HGPU_OUT_FMT_MB:  printf( " (%5.3f MB)", ( param / 1024. / 1024. ) );         break;
-            case HGPU_OUT_FMT_GB:  printf( " (%5.3f GB)", ( param / 1024. / 1024. / 1024. ) ); break;
-            case HGPU_OUT_FMT_MHz: printf( " MHz" );                                           break;
-        }
-        printf( HGPU_OUT_FMT_END );
+            HGPU_output_str( param_name, infobuf );
     }
 
     cl_uint
-    clGetDeviceInfoUint( cl_device_id device, cl_device_info inf, const char* param_name, int fmt_type = HGPU_OUT_FMT_NONE )
+    clGetDeviceInfoUint( cl_device_id device, cl_device_info inf, const char* param_name, int fmt_type = HGPU_OUT_FMT_NONE, const char* unit = NULL )
     {
         cl_uint rslt;
-        cl_int CLerr = clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
+        cl_int CLerr = HGPU_clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
         if ( CLerr == CL_SUCCESS )
-        {
-            printf( HGPU_OUT_FMT_UINT0, param_name, (unsigned int) rslt );
-            clPrintAddFmt( rslt, fmt_type );
-        }
+            HGPU_output_uint( param_name, rslt, fmt_type, unit );
         return rslt;
     }
 
@@ -154,35 +110,29 @@
     clGetDeviceInfoHex( cl_device_id device, cl_device_info inf, const char* param_name )
     {
         cl_uint rslt;
-        cl_int CLerr = clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
+        cl_int CLerr = HGPU_clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
         if ( CLerr == CL_SUCCESS )
-            printf( HGPU_OUT_FMT_HEX, param_name, rslt );
+            HGPU_output_hex( param_name, rslt );
         return rslt;
     }
 
     size_t
-    clGetDeviceInfoSizeT( cl_device_id device, cl_device_info inf, const char* param_name, int fmt_type = HGPU_OUT_FMT_NONE )
+    clGetDeviceInfoSizeT( cl_device_id device, cl_device_info inf, const char* param_name, int fmt_type = HGPU_OUT_FMT_NONE, const char* unit = NULL )
     {
         size_t rslt;
-        cl_int CLerr = clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
+        cl_int CLerr = HGPU_clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
         if ( CLerr == CL_SUCCESS )
-        {
-            printf( HGPU_OUT_FMT_UINT0, param_name, (unsigned int) rslt );
-            clPrintAddFmt( rslt, fmt_type );
-        }
+            HGPU_output_uint( param_name, rslt, fmt_type, unit );
         return rslt;
     }
 
     cl_ulong
-    clGetDeviceInfoUlong( cl_device_id device, cl_device_info inf, const char* param_name, int fmt_type = HGPU_OUT_FMT_NONE )
+    clGetDeviceInfoUlong( cl_device_id device, cl_device_info inf, const char* param_name, int fmt_type = HGPU_OUT_FMT_NONE, const char* unit = NULL )
     {
         cl_ulong rslt;
-        cl_int CLerr = clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
+        cl_int CLerr = HGPU_clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
         if ( CLerr == CL_SUCCESS )
-        {
-            printf( HGPU_OUT_FMT_LONG0, param_name, (long long unsigned int) rslt );
-            clPrintAddFmt( rslt, fmt_type );
-        }
+            HGPU_output_uint( param_name, rslt, fmt_type, unit );
 
         return rslt;
     }
@@ -191,12 +141,82 @@
     clGetDeviceInfoBool( cl_device_id device, cl_device_info inf, const char* param_name )
     {
         cl_bool rslt;
-        cl_int CLerr = clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
+        cl_int CLerr = HGPU_clGetDeviceInfo( device, inf, sizeof(rslt), &rslt, NULL );
         if ( CLerr == CL_SUCCESS )
-            printf( HGPU_OUT_FMT_STR, param_name, ( (rslt) ? "Yes" : "No" ) );
+            HGPU_output_bool( param_name, ( rslt != CL_FALSE ) );
         return rslt;
     }
 
+    static const HGPU_output_flag HGPU_device_types[] = {
+        { CL_DEVICE_TYPE_CPU,                            "CPU",                                         0 },
+        { CL_DEVICE_TYPE_GPU,                            "GPU",                                         0 },
+        { CL_DEVICE_TYPE_ACCELERATOR,                    "ACCELERATOR",                                 0 },
+        { CL_DEVICE_TYPE_DEFAULT,                        "DEFAULT",                                     0 },
+#if defined( CL_VERSION_1_2 )
+        { CL_DEVICE_TYPE_CUSTOM,                         "CUSTOM",                                      HGPU_OPENCL_1_2 },
+#endif
+    };
+
+    static const HGPU_output_flag HGPU_fp_configs[] = {
+        { CL_FP_DENORM,                                  "CL_FP_DENORM",                                0 },
+        { CL_FP_INF_NAN,                                 "CL_FP_INF_NAN",                               0 },
+        { CL_FP_ROUND_TO_NEAREST,                        "CL_FP_ROUND_TO_NEAREST",                      0 },
+        { CL_FP_ROUND_TO_ZERO,                           "CL_FP_ROUND_TO_ZERO",                         0 },
+        { CL_FP_ROUND_TO_INF,                            "CL_FP_ROUND_TO_INF",                          0 },
+        { CL_FP_FMA,                                     "CL_FP_FMA",                                   0 },
+#if defined( CL_VERSION_1_1 )
+        { CL_FP_SOFT_FLOAT,                              "CL_FP_SOFT_FLOAT",                            HGPU_OPENCL_1_1 },
+#endif
+#if defined( CL_VERSION_1_2 )
+        { CL_FP_CORRECTLY_ROUNDED_DIVIDE_SQRT,           "CL_FP_CORRECTLY_ROUNDED_DIVIDE_SQRT",         HGPU_OPENCL_1_2 },
+#endif
+    };
+
+    // CL_FP_CORRECTLY_ROUNDED_DIVIDE_SQRT applies to single precision only
+    static const HGPU_output_flag HGPU_fp_configs_double[] = {
+        { CL_FP_DENORM,                                  "CL_FP_DENORM",                                0 },
+        { CL_FP_INF_NAN,                                 "CL_FP_INF_NAN",                               0 },
+        { CL_FP_ROUND_TO_NEAREST,                        "CL_FP_ROUND_TO_NEAREST",                      0 },
+        { CL_FP_ROUND_TO_ZERO,                           "CL_FP_ROUND_TO_ZERO",                         0 },
+        { CL_FP_ROUND_TO_INF,                            "CL_FP_ROUND_TO_INF",                          0 },
+        { CL_FP_FMA,                                     "CL_FP_FMA",                                   0 },
+#if defined( CL_VERSION_1_1 )
+        { CL_FP_SOFT_FLOAT,                              "CL_FP_SOFT_FLOAT",                            HGPU_OPENCL_1_1 },
+#endif
+    };
+
+#if defined( CL_VERSION_1_2 )
+    static const HGPU_output_flag HGPU_affinity_domains[] = {
+        { CL_DEVICE_AFFINITY_DOMAIN_NUMA,                "CL_DEVICE_AFFINITY_DOMAIN_NUMA",              0 },
+        { CL_DEVICE_AFFINITY_DOMAIN_L4_CACHE,            "CL_DEVICE_AFFINITY_DOMAIN_L4_CACHE",          0 },
+        { CL_DEVICE_AFFINITY_DOMAIN_L3_CACHE,            "CL_DEVICE_AFFINITY_DOMAIN_L3_CACHE",          0 },
+        { CL_DEVICE_AFFINITY_DOMAIN_L2_CACHE,            "CL_DEVICE_AFFINITY_DOMAIN_L2_CACHE",          0 },
+        { CL_DEVICE_AFFINITY_DOMAIN_L1_CACHE,            "CL_DEVICE_AFFINITY_DOMAIN_L1_CACHE",          0 },
+        { CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE,  "CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE", 0 },
+    };
+#endif
+
+#if defined( CL_VERSION_2_0 )
+    static const HGPU_output_flag HGPU_svm_capabilities[] = {
+        { CL_DEVICE_SVM_COARSE_GRAIN_BUFFER,             "CL_DEVICE_SVM_COARSE_GRAIN_BUFFER",           0 },
+        { CL_DEVICE_SVM_FINE_GRAIN_BUFFER,               "CL_DEVICE_SVM_FINE_GRAIN_BUFFER",             0 },
+        { CL_DEVICE_SVM_FINE_GRAIN_SYSTEM,               "CL_DEVICE_SVM_FINE_GRAIN_SYSTEM",             0 },
+        { CL_DEVICE_SVM_ATOMICS,                         "CL_DEVICE_SVM_ATOMICS",                       0 },
+    };
+#endif
+
+    static const HGPU_output_flag HGPU_exec_capabilities[] = {
+        { CL_EXEC_KERNEL,                                "CL_EXEC_KERNEL",                              0 },
+        { CL_EXEC_NATIVE_KERNEL,                         "CL_EXEC_NATIVE_KERNEL",                       0 },
+    };
+
+    static const HGPU_output_flag HGPU_queue_properties[] = {
+        { CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE,        "CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE",      0 },
+        { CL_QUEUE_PROFILING_ENABLE,                     "CL_QUEUE_PROFILING_ENABLE",                   0 },
+    };
+
+#define HGPU_FLAGS_NUMBER(flags)    ( sizeof(flags) / sizeof(flags[0]) )
+
 int main(int argc, char ** argv)
 {
     char infobuf[4096];
@@ -210,22 +230,55 @@ int main(int argc, char ** argv)
     cl_device_local_mem_type    local_mem_type;
     cl_device_exec_capabilities device_exec_cap;
     cl_command_queue_properties comqueue_properties;
+    int bench_mask = 0;
+    int output_format = HGPU_OUTPUT_FORMAT_TEXT;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        if( !strcmp( argv[i], "--record" ) && ( i + 1 < argc ) )
+            HGPU_capture_open( HGPU_CAPTURE_MODE_RECORD, argv[++i] );
+        else if( !strcmp( argv[i], "--replay" ) && ( i + 1 < argc ) )
+            HGPU_capture_open( HGPU_CAPTURE_MODE_REPLAY, argv[++i] );
+#ifndef HGPU_REPLAY_ONLY
+        else if( !strcmp( argv[i], "--bench" ) && ( i + 1 < argc ) && HGPU_bench_parse( argv[i + 1] ) )
+            bench_mask |= HGPU_bench_parse( argv[++i] );
+#endif
+        else if( !strcmp( argv[i], "--format" ) && ( i + 1 < argc ) && HGPU_output_parse( argv[i + 1] ) )
+            output_format = HGPU_output_parse( argv[++i] );
+        else
+        {
+            HGPU_print_usage( argv[0] );
+            exit( 1 );
+        }
+    }
+#ifdef HGPU_REPLAY_ONLY
+    if( HGPU_capture_mode() != HGPU_CAPTURE_MODE_REPLAY )
+    {
+        HGPU_print_usage( argv[0] );
+        exit( 1 );
+    }
+#endif
+    HGPU_output_open( output_format );
+    if( bench_mask && ( HGPU_capture_mode() == HGPU_CAPTURE_MODE_REPLAY ) )
+    {
+        HGPU_output_message( "Benchmarks are not available in replay mode\n" );
+        bench_mask = 0;
+    }
 
-    HGPU_GPU_error_message( clGetPlatformIDs( 0, NULL, &platform_number ), "clGetPlatformIDs failed" );
+    HGPU_GPU_error_message( HGPU_clGetPlatformIDs( 0, NULL, &platform_number ), "clGetPlatformIDs failed" );
     if( platform_number == 0 )
     {
-        printf( "There are no any available OpenCL platforms\n" );
+        HGPU_output_message( "There are no any available OpenCL platforms\n" );
         exit( 0 );
     }
 
     cl_platform_id* platforms = new cl_platform_id[platform_number];
-    HGPU_GPU_error_message( clGetPlatformIDs( platform_number, platforms, NULL ), "clGetPlatformIDs failed" );
-    printf( "Platforms available: %u\n", platform_number );
+    HGPU_GPU_error_message( HGPU_clGetPlatformIDs( platform_number, platforms, NULL ), "clGetPlatformIDs failed" );
+    HGPU_output_begin( platform_number );
     for( size_t i = 0; i < platform_number; i++ )
     {
         platform = platforms[i];
-        printf( "--------------------------------------------------------------------------------------\n" );
-        printf( "Info on platform %u\n", (unsigned int) ( i + 1 ) );
+        HGPU_output_platform_begin( (unsigned int) ( i + 1 ) );
         clGetPlatformInfoStr( platforms[i], CL_PLATFORM_NAME,       "CL_PLATFORM_NAME"       );
         clGetPlatformInfoStr( platforms[i], CL_PLATFORM_VENDOR,     "CL_PLATFORM_VENDOR"     );
         clGetPlatformInfoStr( platforms[i], CL_PLATFORM_VERSION,    "CL_PLATFORM_VERSION"    );
@@ -235,10 +288,10 @@ int main(int argc, char ** argv)
 #endif
         clGetPlatformInfoStr( platforms[i], CL_PLATFORM_EXTENSIONS, "CL_PLATFORM_EXTENSIONS" );
 
-        HGPU_GPU_error_message( clGetDeviceIDs( platform, CL_DEVICE_TYPE_ALL, 0, 0, &devices_number ), "clGetDeviceIDs failed" );
+        HGPU_GPU_error_message( HGPU_clGetDeviceIDs( platform, CL_DEVICE_TYPE_ALL, 0, 0, &devices_number ), "clGetDeviceIDs failed" );
         cl_device_id* devices = new cl_device_id[devices_number];
-        HGPU_GPU_error_message( clGetDeviceIDs( platform, CL_DEVICE_TYPE_ALL, devices_number, devices, &devices_number ), "clGetDeviceIDs failed" );
-        printf( "Devices available: %u\n", devices_number );
+        HGPU_GPU_error_message( HGPU_clGetDeviceIDs( platform, CL_DEVICE_TYPE_ALL, devices_number, devices, &devices_number ), "clGetDeviceIDs failed" );
+        HGPU_output_platform_end( devices_number );
         for( size_t t = 0; t < devices_number; t++ )
         {
             int device_opencl_c_version = 0;
@@ -248,19 +301,18 @@ int main(int argc, char ** argv)
             cl_device_fp_config fp_config;
             cl_device_mem_cache_type mem_cache_type;
 
-            printf( "--------------------------------------------------------------------------------------\n" );
-            printf( "Info on device %u\n", (unsigned int) ( t + 1 ) );
+            HGPU_output_device_begin( (unsigned int) ( i + 1 ), (unsigned int) ( t + 1 ) );
 
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_VENDOR, sizeof(infobuf), &infobuf, NULL ), "clGetDeviceInfo failed" );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_VENDOR, sizeof(infobuf), &infobuf, NULL ), "clGetDeviceInfo failed" );
                 if( strstr( infobuf, HGPU_DEVICE_VENDOR_AMD    ) ) device_vendor = HGPU_VENDOR_AMD;
                 if( strstr( infobuf, HGPU_DEVICE_VENDOR_NVIDIA ) ) device_vendor = HGPU_VENDOR_NVIDIA;
                 if( strstr( infobuf, HGPU_DEVICE_VENDOR_INTEL  ) ) device_vendor = HGPU_VENDOR_INTEL;
 
             switch( device_vendor )
             {
-                case HGPU_VENDOR_AMD:    printf( HGPU_OUT_FMT_STR, "DEVICE VENDOR", "AMD"    ); break;
-                case HGPU_VENDOR_NVIDIA: printf( HGPU_OUT_FMT_STR, "DEVICE VENDOR", "NVIDIA" ); break;
-                case HGPU_VENDOR_INTEL:  printf( HGPU_OUT_FMT_STR, "DEVICE VENDOR", "INTEL"  ); break;
+                case HGPU_VENDOR_AMD:    HGPU_output_str( "DEVICE VENDOR", "AMD"    ); break;
+                case HGPU_VENDOR_NVIDIA: HGPU_output_str( "DEVICE VENDOR", "NVIDIA" ); break;
+                case HGPU_VENDOR_INTEL:  HGPU_output_str( "DEVICE VENDOR", "INTEL"  ); break;
             }
 
             clGetDeviceInfoStr( devices[t], CL_DEVICE_NAME,    "CL_DEVICE_NAME"    );
@@ -272,26 +324,14 @@ int main(int argc, char ** argv)
             clGetDeviceInfoStr( devices[t], CL_DRIVER_VERSION, "CL_DRIVER_VERSION" );
             clGetDeviceInfoStr( devices[t], CL_DEVICE_PROFILE, "CL_DEVICE_PROFILE" );
             clGetDeviceInfoStr( devices[t], CL_DEVICE_VERSION, "CL_DEVICE_VERSION" );
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_OPENCL_C_VERSION, sizeof(infobuf), &infobuf, NULL ), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_STR, "CL_DEVICE_OPENCL_C_VERSION", infobuf );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_OPENCL_C_VERSION, sizeof(infobuf), &infobuf, NULL ), "clGetDeviceInfo failed" );
+            HGPU_output_str( "CL_DEVICE_OPENCL_C_VERSION", infobuf );
                 if( strstr( infobuf, HGPU_OPENCL_VERSION_1_0 ) ) device_opencl_c_version = HGPU_OPENCL_1_0;
                 if( strstr( infobuf, HGPU_OPENCL_VERSION_1_1 ) ) device_opencl_c_version = HGPU_OPENCL_1_1;
                 if( strstr( infobuf, HGPU_OPENCL_VERSION_1_2 ) ) device_opencl_c_version = HGPU_OPENCL_1_2;
                 if( strstr( infobuf, HGPU_OPENCL_VERSION_2_0 ) ) device_opencl_c_version = HGPU_OPENCL_2_0;
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_TYPE, sizeof(device_type), &device_type, NULL ), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_TYPE" );
-            if( device_type & CL_DEVICE_TYPE_CPU         ) printf( "CPU "         );
-            if( device_type & CL_DEVICE_TYPE_GPU         ) printf( "GPU "         );
-            if( device_type & CL_DEVICE_TYPE_ACCELERATOR ) printf( "ACCELERATOR " );
-            if( device_type & CL_DEVICE_TYPE_DEFAULT     ) printf( "DEFAULT "     );
-
-#if defined( CL_VERSION_1_2 )
-            if( device_opencl_c_version >= HGPU_OPENCL_1_2 )
-            {
-                if( device_type & CL_DEVICE_TYPE_CUSTOM  ) printf( "CUSTOM "      );
-            }
-#endif
-            printf( "\n" );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_TYPE, sizeof(device_type), &device_type, NULL ), "clGetDeviceInfo failed" );
+            HGPU_output_flags( "CL_DEVICE_TYPE", device_type, HGPU_device_types, HGPU_FLAGS_NUMBER( HGPU_device_types ), HGPU_OUTPUT_FLAGS_INLINE, device_opencl_c_version );
 
 #if defined( CL_DEVICE_SPIR_VERSIONS )
             clGetDeviceInfoStr( devices[t], CL_DEVICE_SPIR_VERSIONS, "CL_DEVICE_SPIR_VERSIONS" );
@@ -304,63 +344,63 @@ int main(int argc, char ** argv)
 #if ( defined( CL_DEVICE_GFXIP_MAJOR_AMD ) && defined( CL_DEVICE_GFXIP_MINOR_AMD ) )
             cl_uint GFXIP_major = 0;
             cl_uint GFXIP_minor = 0;
-            CLerr  = clGetDeviceInfo( devices[t], CL_DEVICE_GFXIP_MAJOR_AMD, sizeof(GFXIP_major), &GFXIP_major, NULL );
-            CLerr2 = clGetDeviceInfo( devices[t], CL_DEVICE_GFXIP_MINOR_AMD, sizeof(GFXIP_minor), &GFXIP_minor, NULL );
+            CLerr  = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_GFXIP_MAJOR_AMD, sizeof(GFXIP_major), &GFXIP_major, NULL );
+            CLerr2 = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_GFXIP_MINOR_AMD, sizeof(GFXIP_minor), &GFXIP_minor, NULL );
             if( ( CLerr | CLerr2 ) == CL_SUCCESS )
             {
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_GFXIP_MAJOR/MINOR_AMD" );
-                printf( "%u.%u\n", GFXIP_major, GFXIP_minor );
+                sprintf( infobuf, "%u.%u", GFXIP_major, GFXIP_minor );
+                HGPU_output_str( "CL_DEVICE_GFXIP_MAJOR/MINOR_AMD", infobuf );
             }
 #endif
 #if ( defined( CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV ) && defined( CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV ) )
             cl_uint NVCC_major = 0;
             cl_uint NVCC_minor = 0;
-            CLerr  = clGetDeviceInfo( devices[t], CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV, sizeof(NVCC_major), &NVCC_major, NULL );
-            CLerr2 = clGetDeviceInfo( devices[t], CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV, sizeof(NVCC_minor), &NVCC_minor, NULL );
+            CLerr  = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV, sizeof(NVCC_major), &NVCC_major, NULL );
+            CLerr2 = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV, sizeof(NVCC_minor), &NVCC_minor, NULL );
             if( ( CLerr | CLerr2 ) == CL_SUCCESS )
             {
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_COMPUTE_CAPABILITY_MAJOR/MINOR_NV" );
-                printf( "%u.%u\n", NVCC_major, NVCC_minor );
+                sprintf( infobuf, "%u.%u", NVCC_major, NVCC_minor );
+                HGPU_output_str( "CL_DEVICE_COMPUTE_CAPABILITY_MAJOR/MINOR_NV", infobuf );
             }
 #endif
 
             infoitemdims = clGetDeviceInfoUint( devices[t], CL_DEVICE_MAX_WORK_ITEM_DIMENSIONS, "CL_DEVICE_MAX_WORK_ITEM_DIMENSIONS" );
             if ( infoitemdims > 0 )
             {
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_MAX_WORK_ITEM_SIZES, sizeof(workitemdims), &workitemdims, NULL ), "clGetDeviceInfo failed" );
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_MAX_WORK_ITEM_SIZES" );
+                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_MAX_WORK_ITEM_SIZES, sizeof(workitemdims), &workitemdims, NULL ), "clGetDeviceInfo failed" );
+                std::vector<unsigned long long> workitemsizes;
                 for( unsigned int j = 0; j < infoitemdims; j++ )
-                    printf( "%u ", (unsigned int) workitemdims[j] );
-                printf( "\n" );
+                    workitemsizes.push_back( workitemdims[j] );
+                HGPU_output_list( "CL_DEVICE_MAX_WORK_ITEM_SIZES", workitemsizes, NULL, HGPU_OUTPUT_LIST_TERMINATED );
             }
             clGetDeviceInfoSizeT( devices[t], CL_DEVICE_MAX_WORK_GROUP_SIZE,            "CL_DEVICE_MAX_WORK_GROUP_SIZE"           );
 
 #if defined( CL_DEVICE_TOPOLOGY_AMD )
             cl_device_topology_amd topology_amd;
-            CLerr = clGetDeviceInfo( devices[t], CL_DEVICE_TOPOLOGY_AMD, sizeof(topology_amd), &topology_amd, NULL );
+            CLerr = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_TOPOLOGY_AMD, sizeof(topology_amd), &topology_amd, NULL );
             if( CLerr == CL_SUCCESS )
             {
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_TOPOLOGY_AMD" );
                 if ( topology_amd.raw.type == CL_DEVICE_TOPOLOGY_TYPE_PCIE_AMD )
                 {
-                    printf( "PCIe, %02x:%02x.%u\n", topology_amd.pcie.bus, topology_amd.pcie.device, topology_amd.pcie.function );
+                    sprintf( infobuf, "PCIe, %02x:%02x.%u", topology_amd.pcie.bus, topology_amd.pcie.device, topology_amd.pcie.function );
                 }
                 else
                 {
-                    printf( "type/raw %04x:%04x\n", (unsigned int) topology_amd.raw.type, (unsigned int) topology_amd.raw.data[4] );
+                    sprintf( infobuf, "type/raw %04x:%04x", (unsigned int) topology_amd.raw.type, (unsigned int) topology_amd.raw.data[4] );
                 }
+                HGPU_output_str( "CL_DEVICE_TOPOLOGY_AMD", infobuf );
             }
 #endif
 
 #if ( defined( CL_DEVICE_PCI_BUS_ID_NV ) && defined( CL_DEVICE_PCI_SLOT_ID_NV ) )
             cl_uint NV_bus  = 0;
             cl_uint NV_slot = 0;
-            CLerr  = clGetDeviceInfo( devices[t], CL_DEVICE_PCI_BUS_ID_NV, sizeof(NV_bus), &NV_bus, NULL );
-            CLerr2 = clGetDeviceInfo( devices[t], CL_DEVICE_PCI_SLOT_ID_NV, sizeof(NV_slot), &NV_slot, NULL );
+            CLerr  = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_PCI_BUS_ID_NV, sizeof(NV_bus), &NV_bus, NULL );
+            CLerr2 = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_PCI_SLOT_ID_NV, sizeof(NV_slot), &NV_slot, NULL );
             if( ( CLerr | CLerr2 ) == CL_SUCCESS )
             {
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_PCI_BUS/SLOT_ID_NV" );
-                printf( "%02x:%02x\n", NV_bus, NV_slot );
+                sprintf( infobuf, "%02x:%02x", NV_bus, NV_slot );
+                HGPU_output_str( "CL_DEVICE_PCI_BUS/SLOT_ID_NV", infobuf );
             }
 #endif
 #if defined( CL_DEVICE_REGISTERS_PER_BLOCK_NV )
@@ -422,9 +462,9 @@ int main(int argc, char ** argv)
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_NATIVE_VECTOR_WIDTH_HALF,    "CL_DEVICE_NATIVE_VECTOR_WIDTH_HALF"      );
             }
 #endif
-            clGetDeviceInfoUint(  devices[t], CL_DEVICE_MAX_CLOCK_FREQUENCY,  "CL_DEVICE_MAX_CLOCK_FREQUENCY", HGPU_OUT_FMT_MHz   );
+            clGetDeviceInfoUint(  devices[t], CL_DEVICE_MAX_CLOCK_FREQUENCY,  "CL_DEVICE_MAX_CLOCK_FREQUENCY", HGPU_OUT_FMT_MHz, HGPU_OUTPUT_UNIT_MHZ );
             clGetDeviceInfoUint(  devices[t], CL_DEVICE_ADDRESS_BITS,         "CL_DEVICE_ADDRESS_BITS"         );
-            clGetDeviceInfoUlong( devices[t], CL_DEVICE_MAX_MEM_ALLOC_SIZE,   "CL_DEVICE_MAX_MEM_ALLOC_SIZE",  HGPU_OUT_FMT_GB    );
+            clGetDeviceInfoUlong( devices[t], CL_DEVICE_MAX_MEM_ALLOC_SIZE,   "CL_DEVICE_MAX_MEM_ALLOC_SIZE", HGPU_OUT_FMT_GB, HGPU_OUTPUT_UNIT_BYTES );
             clGetDeviceInfoBool(  devices[t], CL_DEVICE_IMAGE_SUPPORT,        "CL_DEVICE_IMAGE_SUPPORT"        );
             clGetDeviceInfoUint(  devices[t], CL_DEVICE_MAX_READ_IMAGE_ARGS,  "CL_DEVICE_MAX_READ_IMAGE_ARGS"  );
             clGetDeviceInfoUint(  devices[t], CL_DEVICE_MAX_WRITE_IMAGE_ARGS, "CL_DEVICE_MAX_WRITE_IMAGE_ARGS" );
@@ -450,57 +490,36 @@ int main(int argc, char ** argv)
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_IMAGE_BASE_ADDRESS_ALIGNMENT, "CL_DEVICE_IMAGE_BASE_ADDRESS_ALIGNMENT" );
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_MAX_PIPE_ARGS,                "CL_DEVICE_MAX_PIPE_ARGS"                );
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_PIPE_MAX_ACTIVE_RESERVATIONS, "CL_DEVICE_PIPE_MAX_ACTIVE_RESERVATIONS" );
-                clGetDeviceInfoUint( devices[t], CL_DEVICE_PIPE_MAX_PACKET_SIZE,         "CL_DEVICE_PIPE_MAX_PACKET_SIZE"         );
+                clGetDeviceInfoUint( devices[t], CL_DEVICE_PIPE_MAX_PACKET_SIZE,         "CL_DEVICE_PIPE_MAX_PACKET_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
             // }
 #endif
 
-            clGetDeviceInfoSizeT( devices[t], CL_DEVICE_MAX_PARAMETER_SIZE,       "CL_DEVICE_MAX_PARAMETER_SIZE",   HGPU_OUT_FMT_KB );
-            clGetDeviceInfoUint(  devices[t], CL_DEVICE_MIN_DATA_TYPE_ALIGN_SIZE, "CL_DEVICE_MIN_DATA_TYPE_ALIGN_SIZE" );
-            clGetDeviceInfoUint(  devices[t], CL_DEVICE_MEM_BASE_ADDR_ALIGN,      "CL_DEVICE_MEM_BASE_ADDR_ALIGN"      );
+            clGetDeviceInfoSizeT( devices[t], CL_DEVICE_MAX_PARAMETER_SIZE,       "CL_DEVICE_MAX_PARAMETER_SIZE", HGPU_OUT_FMT_KB, HGPU_OUTPUT_UNIT_BYTES );
+            clGetDeviceInfoUint(  devices[t], CL_DEVICE_MIN_DATA_TYPE_ALIGN_SIZE, "CL_DEVICE_MIN_DATA_TYPE_ALIGN_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
+            clGetDeviceInfoUint(  devices[t], CL_DEVICE_MEM_BASE_ADDR_ALIGN,      "CL_DEVICE_MEM_BASE_ADDR_ALIGN", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BITS );
 
-            printf( HGPU_OUT_FMT_N0STR, "CL_DEVICE_SINGLE_FP_CONFIG configuration" );
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_SINGLE_FP_CONFIG, sizeof(fp_config), &fp_config, NULL ), "clGetDeviceInfo failed" );
-                printf( "\tCL_FP_DENORM:           %s\n", ( ( fp_config & CL_FP_DENORM )           ? "Yes" : "No" ) );
-                printf( "\tCL_FP_INF_NAN:          %s\n", ( ( fp_config & CL_FP_INF_NAN )          ? "Yes" : "No" ) );
-                printf( "\tCL_FP_ROUND_TO_NEAREST: %s\n", ( ( fp_config & CL_FP_ROUND_TO_NEAREST ) ? "Yes" : "No" ) );
-                printf( "\tCL_FP_ROUND_TO_ZERO:    %s\n", ( ( fp_config & CL_FP_ROUND_TO_ZERO )    ? "Yes" : "No" ) );
-                printf( "\tCL_FP_ROUND_TO_INF:     %s\n", ( ( fp_config & CL_FP_ROUND_TO_INF )     ? "Yes" : "No" ) );
-                printf( "\tCL_FP_FMA:              %s\n", ( ( fp_config & CL_FP_FMA )              ? "Yes" : "No" ) );
-#if defined( CL_VERSION_1_1 )
-                if( device_opencl_c_version >= HGPU_OPENCL_1_1 )
-                {
-                    printf( "\tCL_FP_SOFT_FLOAT:       %s\n", ( ( fp_config & CL_FP_SOFT_FLOAT )   ? "Yes" : "No" ) );
-                }
-#endif
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_SINGLE_FP_CONFIG, sizeof(fp_config), &fp_config, NULL ), "clGetDeviceInfo failed" );
+            HGPU_output_flags( "CL_DEVICE_SINGLE_FP_CONFIG", fp_config, HGPU_fp_configs, HGPU_FLAGS_NUMBER( HGPU_fp_configs ), HGPU_OUTPUT_FLAGS_YESNO, device_opencl_c_version );
 
 #if defined( CL_VERSION_1_2 )
             if( device_opencl_c_version >= HGPU_OPENCL_1_2 )
             {
-                    printf( "\tCL_FP_CORRECTLY_ROUNDED_DIVIDE_SQRT: %s\n", ( ( fp_config & CL_FP_CORRECTLY_ROUNDED_DIVIDE_SQRT ) ? "Yes" : "No" ) );
-
-                printf( HGPU_OUT_FMT_N0STR, "CL_DEVICE_DOUBLE_FP_CONFIG configuration" );
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_DOUBLE_FP_CONFIG, sizeof(fp_config), &fp_config, NULL ), "clGetDeviceInfo failed" );
-                    printf( "\tCL_FP_DENORM:           %s\n", ( ( fp_config & CL_FP_DENORM )           ? "Yes" : "No" ) );
-                    printf( "\tCL_FP_INF_NAN:          %s\n", ( ( fp_config & CL_FP_INF_NAN )          ? "Yes" : "No" ) );
-                    printf( "\tCL_FP_ROUND_TO_NEAREST: %s\n", ( ( fp_config & CL_FP_ROUND_TO_NEAREST ) ? "Yes" : "No" ) );
-                    printf( "\tCL_FP_ROUND_TO_ZERO:    %s\n", ( ( fp_config & CL_FP_ROUND_TO_ZERO )    ? "Yes" : "No" ) );
-                    printf( "\tCL_FP_ROUND_TO_INF:     %s\n", ( ( fp_config & CL_FP_ROUND_TO_INF )     ? "Yes" : "No" ) );
-                    printf( "\tCL_FP_FMA:              %s\n", ( ( fp_config & CL_FP_FMA )              ? "Yes" : "No" ) );
-                    printf( "\tCL_FP_SOFT_FLOAT:       %s\n", ( ( fp_config & CL_FP_SOFT_FLOAT )       ? "Yes" : "No" ) );
+                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_DOUBLE_FP_CONFIG, sizeof(fp_config), &fp_config, NULL ), "clGetDeviceInfo failed" );
+                HGPU_output_flags( "CL_DEVICE_DOUBLE_FP_CONFIG", fp_config, HGPU_fp_configs_double, HGPU_FLAGS_NUMBER( HGPU_fp_configs_double ), HGPU_OUTPUT_FLAGS_YESNO, device_opencl_c_version );
             }
 #endif
 
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_GLOBAL_MEM_CACHE_TYPE, sizeof(mem_cache_type), &mem_cache_type, NULL ), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_GLOBAL_MEM_CACHE_TYPE" );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_GLOBAL_MEM_CACHE_TYPE, sizeof(mem_cache_type), &mem_cache_type, NULL ), "clGetDeviceInfo failed" );
             switch ( mem_cache_type )
             {
-                case CL_NONE:             printf( "NONE\n"             ); break;
-                case CL_READ_ONLY_CACHE:  printf( "READ_ONLY_CACHE\n"  ); break;
-                case CL_READ_WRITE_CACHE: printf( "READ_WRITE_CACHE\n" ); break;
+                case CL_NONE:             HGPU_output_str( "CL_DEVICE_GLOBAL_MEM_CACHE_TYPE", "NONE"             ); break;
+                case CL_READ_ONLY_CACHE:  HGPU_output_str( "CL_DEVICE_GLOBAL_MEM_CACHE_TYPE", "READ_ONLY_CACHE"  ); break;
+                case CL_READ_WRITE_CACHE: HGPU_output_str( "CL_DEVICE_GLOBAL_MEM_CACHE_TYPE", "READ_WRITE_CACHE" ); break;
+                default:                  HGPU_output_hex( "CL_DEVICE_GLOBAL_MEM_CACHE_TYPE", mem_cache_type     ); break;
             }
 
-            clGetDeviceInfoUint(  devices[t], CL_DEVICE_GLOBAL_MEM_CACHELINE_SIZE, "CL_DEVICE_GLOBAL_MEM_CACHELINE_SIZE" );
-            clGetDeviceInfoUlong( devices[t], CL_DEVICE_GLOBAL_MEM_CACHE_SIZE,     "CL_DEVICE_GLOBAL_MEM_CACHE_SIZE",       HGPU_OUT_FMT_KB );
+            clGetDeviceInfoUint(  devices[t], CL_DEVICE_GLOBAL_MEM_CACHELINE_SIZE, "CL_DEVICE_GLOBAL_MEM_CACHELINE_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
+            clGetDeviceInfoUlong( devices[t], CL_DEVICE_GLOBAL_MEM_CACHE_SIZE,     "CL_DEVICE_GLOBAL_MEM_CACHE_SIZE", HGPU_OUT_FMT_KB, HGPU_OUTPUT_UNIT_BYTES );
 
 #if defined( CL_DEVICE_GLOBAL_MEM_CHANNELS_AMD )
             clGetDeviceInfoUint(  devices[t], CL_DEVICE_GLOBAL_MEM_CHANNELS_AMD,   "CL_DEVICE_GLOBAL_MEM_CHANNELS_AMD"   );
@@ -514,42 +533,36 @@ int main(int argc, char ** argv)
 #if defined( CL_DEVICE_GLOBAL_FREE_MEMORY_AMD )
             size_t amdfreemem[1024];
             size_t reslt_siz = 0;
-            CLerr = clGetDeviceInfo( devices[t], CL_DEVICE_GLOBAL_FREE_MEMORY_AMD, sizeof(amdfreemem), &amdfreemem, &reslt_siz );
-            printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_GLOBAL_FREE_MEMORY_AMD" );
-            bool flag_free = false;
-            for( size_t u = 0; u < reslt_siz; u++ )
-            {
+            CLerr = HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_GLOBAL_FREE_MEMORY_AMD, sizeof(amdfreemem), &amdfreemem, &reslt_siz );
+            std::vector<unsigned long long> freemem;
+            for( size_t u = 0; ( CLerr == CL_SUCCESS ) && ( u < reslt_siz / sizeof(amdfreemem[0]) ); u++ )
                 if( amdfreemem[u] )
-                {
-                    if( flag_free ) printf( ", " );
-                    printf( "%u", (unsigned int) amdfreemem[u] );
-                    flag_free = true;
-                }
-            }
-            printf( "\n" );
+                    freemem.push_back( amdfreemem[u] );
+            // reported in KB: text keeps KB, typed values are bytes
+            HGPU_output_list( "CL_DEVICE_GLOBAL_FREE_MEMORY_AMD", freemem, HGPU_OUTPUT_UNIT_BYTES, HGPU_OUTPUT_LIST_JOINED, 1024 );
 #endif
 
-            clGetDeviceInfoUlong( devices[t], CL_DEVICE_GLOBAL_MEM_SIZE,           "CL_DEVICE_GLOBAL_MEM_SIZE",             HGPU_OUT_FMT_GB );
-            clGetDeviceInfoUlong( devices[t], CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE,  "CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE",    HGPU_OUT_FMT_KB );
+            clGetDeviceInfoUlong( devices[t], CL_DEVICE_GLOBAL_MEM_SIZE,           "CL_DEVICE_GLOBAL_MEM_SIZE", HGPU_OUT_FMT_GB, HGPU_OUTPUT_UNIT_BYTES );
+            clGetDeviceInfoUlong( devices[t], CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE,  "CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE", HGPU_OUT_FMT_KB, HGPU_OUTPUT_UNIT_BYTES );
             clGetDeviceInfoUint(  devices[t], CL_DEVICE_MAX_CONSTANT_ARGS,         "CL_DEVICE_MAX_CONSTANT_ARGS"         );
 
 #if defined( CL_VERSION_2_0 )
             if( device_opencl_c_version >= HGPU_OPENCL_2_0 )
             {
-                clGetDeviceInfoSizeT( devices[t], CL_DEVICE_MAX_GLOBAL_VARIABLE_SIZE,             "CL_DEVICE_MAX_GLOBAL_VARIABLE_SIZE"             );
-                clGetDeviceInfoSizeT( devices[t], CL_DEVICE_GLOBAL_VARIABLE_PREFERRED_TOTAL_SIZE, "CL_DEVICE_GLOBAL_VARIABLE_PREFERRED_TOTAL_SIZE" );
+                clGetDeviceInfoSizeT( devices[t], CL_DEVICE_MAX_GLOBAL_VARIABLE_SIZE,             "CL_DEVICE_MAX_GLOBAL_VARIABLE_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
+                clGetDeviceInfoSizeT( devices[t], CL_DEVICE_GLOBAL_VARIABLE_PREFERRED_TOTAL_SIZE, "CL_DEVICE_GLOBAL_VARIABLE_PREFERRED_TOTAL_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
             }
 #endif
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_LOCAL_MEM_TYPE, sizeof(local_mem_type), &local_mem_type, NULL ), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_LOCAL_MEM_TYPE" );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_LOCAL_MEM_TYPE, sizeof(local_mem_type), &local_mem_type, NULL ), "clGetDeviceInfo failed" );
             switch ( local_mem_type )
             {
-                case CL_LOCAL:  printf( "local\n"  ); break;
-                case CL_GLOBAL: printf( "global\n" ); break;
+                case CL_LOCAL:  HGPU_output_str( "CL_DEVICE_LOCAL_MEM_TYPE", "local"  ); break;
+                case CL_GLOBAL: HGPU_output_str( "CL_DEVICE_LOCAL_MEM_TYPE", "global" ); break;
+                default:        HGPU_output_hex( "CL_DEVICE_LOCAL_MEM_TYPE", local_mem_type ); break;
             }
-            clGetDeviceInfoUlong( devices[t], CL_DEVICE_LOCAL_MEM_SIZE,             "CL_DEVICE_LOCAL_MEM_SIZE",               HGPU_OUT_FMT_KB );
+            clGetDeviceInfoUlong( devices[t], CL_DEVICE_LOCAL_MEM_SIZE,             "CL_DEVICE_LOCAL_MEM_SIZE", HGPU_OUT_FMT_KB, HGPU_OUTPUT_UNIT_BYTES );
 #if defined( CL_DEVICE_LOCAL_MEM_SIZE_PER_COMPUTE_UNIT_AMD )
-            clGetDeviceInfoUint(  devices[t], CL_DEVICE_LOCAL_MEM_SIZE_PER_COMPUTE_UNIT_AMD, "CL_DEVICE_LOCAL_MEM_SIZE_PER_COMPUTE_UNIT_AMD" );
+            clGetDeviceInfoUint(  devices[t], CL_DEVICE_LOCAL_MEM_SIZE_PER_COMPUTE_UNIT_AMD, "CL_DEVICE_LOCAL_MEM_SIZE_PER_COMPUTE_UNIT_AMD", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
 #endif
 #if defined( CL_DEVICE_LOCAL_MEM_BANKS_AMD )
             clGetDeviceInfoUint(  devices[t], CL_DEVICE_LOCAL_MEM_BANKS_AMD,        "CL_DEVICE_LOCAL_MEM_BANKS_AMD"        );
@@ -563,9 +576,9 @@ int main(int argc, char ** argv)
             }
 #endif
 
-            clGetDeviceInfoSizeT( devices[t], CL_DEVICE_PROFILING_TIMER_RESOLUTION, "CL_DEVICE_PROFILING_TIMER_RESOLUTION" );
+            clGetDeviceInfoSizeT( devices[t], CL_DEVICE_PROFILING_TIMER_RESOLUTION, "CL_DEVICE_PROFILING_TIMER_RESOLUTION", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_NS );
 #if defined( CL_DEVICE_PROFILING_TIMER_OFFSET_AMD )
-            clGetDeviceInfoUlong( devices[t], CL_DEVICE_PROFILING_TIMER_OFFSET_AMD, "CL_DEVICE_PROFILING_TIMER_OFFSET_AMD" );
+            clGetDeviceInfoUlong( devices[t], CL_DEVICE_PROFILING_TIMER_OFFSET_AMD, "CL_DEVICE_PROFILING_TIMER_OFFSET_AMD", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_NS );
 #endif
 
             clGetDeviceInfoBool(  devices[t], CL_DEVICE_ENDIAN_LITTLE,              "CL_DEVICE_ENDIAN_LITTLE"              );
@@ -576,89 +589,54 @@ int main(int argc, char ** argv)
             if( device_opencl_c_version >= HGPU_OPENCL_1_2 )
             {
                 clGetDeviceInfoBool(  devices[t], CL_DEVICE_LINKER_AVAILABLE,            "CL_DEVICE_LINKER_AVAILABLE"            );
-                clGetDeviceInfoSizeT( devices[t], CL_DEVICE_PRINTF_BUFFER_SIZE,          "CL_DEVICE_PRINTF_BUFFER_SIZE",         HGPU_OUT_FMT_MB );
+                clGetDeviceInfoSizeT( devices[t], CL_DEVICE_PRINTF_BUFFER_SIZE,          "CL_DEVICE_PRINTF_BUFFER_SIZE", HGPU_OUT_FMT_MB, HGPU_OUTPUT_UNIT_BYTES );
                 clGetDeviceInfoBool(  devices[t], CL_DEVICE_PREFERRED_INTEROP_USER_SYNC, "CL_DEVICE_PREFERRED_INTEROP_USER_SYNC" );
                 clGetDeviceInfoStr(   devices[t], CL_DEVICE_BUILT_IN_KERNELS,            "CL_DEVICE_BUILT_IN_KERNELS"            );
 
                 cl_device_id device_parent = NULL;
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_PARENT_DEVICE, sizeof(device_parent), device_parent, NULL ), "clGetDeviceInfo failed" );
-                printf( HGPU_OUT_FMT_LONG, "CL_DEVICE_PARENT_DEVICE", (long long unsigned int) device_parent );
+                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_PARENT_DEVICE, sizeof(device_parent), &device_parent, NULL ), "clGetDeviceInfo failed" );
+                HGPU_output_uint( "CL_DEVICE_PARENT_DEVICE", (unsigned long long) device_parent );
 
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_PARTITION_MAX_SUB_DEVICES, "CL_DEVICE_PARTITION_MAX_SUB_DEVICES" );
 
                 cl_device_partition_property part_prop[1024];
                 size_t part_prop_size = 0;
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_PARTITION_PROPERTIES, sizeof(part_prop), part_prop, &part_prop_size ), "clGetDeviceInfo failed" );
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_PARTITION_PROPERTIES" );
-                for( size_t p = 0; p < part_prop_size; p++ )
+                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_PARTITION_PROPERTIES, sizeof(part_prop), part_prop, &part_prop_size ), "clGetDeviceInfo failed" );
+                std::vector<std::string> part_prop_names;
+                for( size_t p = 0; p < part_prop_size / sizeof(part_prop[0]); p++ )
                 {
                     if( part_prop[p] )
                     {
                         switch( part_prop[p] )
                         {
-                            case CL_DEVICE_PARTITION_EQUALLY:            printf( "CL_DEVICE_PARTITION_EQUALLY "            );       break;
-                            case CL_DEVICE_PARTITION_BY_COUNTS:          printf( "CL_DEVICE_PARTITION_BY_COUNTS "          );       break;
-                            case CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN: printf( "CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN " );       break;
+                            case CL_DEVICE_PARTITION_EQUALLY:            part_prop_names.push_back( "CL_DEVICE_PARTITION_EQUALLY"            ); break;
+                            case CL_DEVICE_PARTITION_BY_COUNTS:          part_prop_names.push_back( "CL_DEVICE_PARTITION_BY_COUNTS"          ); break;
+                            case CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN: part_prop_names.push_back( "CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN" ); break;
 #if defined( CL_DEVICE_PARTITION_BY_NAMES_INTEL )
-                            case CL_DEVICE_PARTITION_BY_NAMES_INTEL:     printf( "CL_DEVICE_PARTITION_BY_NAMES_INTEL "     );       break;
+                            case CL_DEVICE_PARTITION_BY_NAMES_INTEL:     part_prop_names.push_back( "CL_DEVICE_PARTITION_BY_NAMES_INTEL"     ); break;
 #else
 #if defined( CL_DEVICE_PARTITION_BY_NAMES_EXT )
-                            case CL_DEVICE_PARTITION_BY_NAMES_EXT:       printf( "CL_DEVICE_PARTITION_BY_NAMES_EXT "       );       break;
-#endif                                                                                                                  
+                            case CL_DEVICE_PARTITION_BY_NAMES_EXT:       part_prop_names.push_back( "CL_DEVICE_PARTITION_BY_NAMES_EXT"       ); break;
 #endif
-                            default:                                     printf( "%#llx ", (long long unsigned int) part_prop[p] ); break;
+#endif
+                            default:
+                                sprintf( infobuf, "%#llx", (long long unsigned int) part_prop[p] );
+                                part_prop_names.push_back( infobuf );
+                                break;
                         }
                     }
                 }
-                printf( "\n" );
+                HGPU_output_names( "CL_DEVICE_PARTITION_PROPERTIES", part_prop_names );
 
                 cl_device_affinity_domain dev_affin;
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_PARTITION_TYPE, sizeof(dev_affin), &dev_affin, NULL ), "clGetDeviceInfo failed" );
+                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_PARTITION_TYPE, sizeof(dev_affin), &dev_affin, NULL ), "clGetDeviceInfo failed" );
                 if( dev_affin != 0 )
-                {
-                    printf( "CL_DEVICE_PARTITION_TYPE:\n" );
-                        if( dev_affin & CL_DEVICE_AFFINITY_DOMAIN_NUMA               ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_AFFINITY_DOMAIN_NUMA"               );
-                        if( dev_affin & CL_DEVICE_AFFINITY_DOMAIN_L4_CACHE           ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_AFFINITY_DOMAIN_L4_CACHE"           );
-                        if( dev_affin & CL_DEVICE_AFFINITY_DOMAIN_L3_CACHE           ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_AFFINITY_DOMAIN_L3_CACHE"           );
-                        if( dev_affin & CL_DEVICE_AFFINITY_DOMAIN_L2_CACHE           ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_AFFINITY_DOMAIN_L2_CACHE"           );
-                        if( dev_affin & CL_DEVICE_AFFINITY_DOMAIN_L1_CACHE           ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_AFFINITY_DOMAIN_L1_CACHE"           );
-                        if( dev_affin & CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE" );
-                }
-
-
-// CL_PARTITION_BY_NAMES_LIST_END_INTEL
-#if defined( CL_DEVICE_PARTITION_PROPERTIES_EXT )
-                cl_device_partition_property_ext part_prop_ext[1024];
-                size_t part_prop_size = 0;
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_PARTITION_PROPERTIES, sizeof(part_prop), part_prop, &part_prop_size ), "clGetDeviceInfo failed" );
-                printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_PARTITION_PROPERTIES" );
-                for( size_t p = 0; p < part_prop_size; p++ )
-                {
-                    if( part_prop[p] )
-                    {
-                        switch( part_prop[p] )
-                        {
-                            case CL_DEVICE_PARTITION_EQUALLY:            printf( "CL_DEVICE_PARTITION_EQUALLY "            );       break;
-                            case CL_DEVICE_PARTITION_BY_COUNTS:          printf( "CL_DEVICE_PARTITION_BY_COUNTS "          );       break;
-                            case CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN: printf( "CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN " );       break;
-#if defined( CL_DEVICE_PARTITION_BY_NAMES_INTEL )
-                            case CL_DEVICE_PARTITION_BY_NAMES_INTEL:     printf( "CL_DEVICE_PARTITION_BY_NAMES_INTEL "     );       break;
-#else
-#if defined( CL_DEVICE_PARTITION_BY_NAMES_EXT )
-                            case CL_DEVICE_PARTITION_BY_NAMES_EXT:       printf( "CL_DEVICE_PARTITION_BY_NAMES_EXT "       );       break;
-#endif                                                                                                                  
-#endif
-                            default:                                     printf( "%#llx ", (long long unsigned int) part_prop[p] ); break;
-                        }
-                    }
-                }
-                printf( "\n" );
-#endif
+                    HGPU_output_flags( "CL_DEVICE_PARTITION_TYPE", dev_affin, HGPU_affinity_domains, HGPU_FLAGS_NUMBER( HGPU_affinity_domains ), HGPU_OUTPUT_FLAGS_LINES, device_opencl_c_version );
 
 
 //#if defined( CL_DEVICE_AFFINITY_DOMAINS_EXT )
 //                cl_device_partition_property_ext dev_affin_ext;
-//                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_AFFINITY_DOMAINS_EXT, sizeof(dev_affin_ext), &dev_affin_ext, NULL ), "clGetDeviceInfo failed" );
+//                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_AFFINITY_DOMAINS_EXT, sizeof(dev_affin_ext), &dev_affin_ext, NULL ), "clGetDeviceInfo failed" );
 //                if( dev_affin_ext )
 //                {
 //                    printf( "CL_DEVICE_AFFINITY_DOMAINS_EXT:\n" );
@@ -692,48 +670,45 @@ int main(int argc, char ** argv)
             if( device_opencl_c_version >= HGPU_OPENCL_2_0 )
             {
                 cl_device_svm_capabilities svm_cap = 0;
-                HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_SVM_CAPABILITIES, sizeof(svm_cap), &svm_cap, NULL ), "clGetDeviceInfo failed" );
-                printf( "CL_DEVICE_SVM_CAPABILITIES:\n" );
-                    if( svm_cap & CL_DEVICE_SVM_COARSE_GRAIN_BUFFER ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_SVM_COARSE_GRAIN_BUFFER" );
-                    if( svm_cap & CL_DEVICE_SVM_FINE_GRAIN_BUFFER   ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_SVM_FINE_GRAIN_BUFFER"   );
-                    if( svm_cap & CL_DEVICE_SVM_FINE_GRAIN_SYSTEM   ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_SVM_FINE_GRAIN_SYSTEM"   );
-                    if( svm_cap & CL_DEVICE_SVM_ATOMICS             ) printf( HGPU_OUT_FMT_TN, "CL_DEVICE_SVM_ATOMICS"             );
-
-                clGetDeviceInfoUint( devices[t], CL_DEVICE_PREFERRED_PLATFORM_ATOMIC_ALIGNMENT, "CL_DEVICE_PREFERRED_PLATFORM_ATOMIC_ALIGNMENT" );
-                clGetDeviceInfoUint( devices[t], CL_DEVICE_PREFERRED_GLOBAL_ATOMIC_ALIGNMENT,   "CL_DEVICE_PREFERRED_GLOBAL_ATOMIC_ALIGNMENT"   );
-                clGetDeviceInfoUint( devices[t], CL_DEVICE_PREFERRED_LOCAL_ATOMIC_ALIGNMENT,    "CL_DEVICE_PREFERRED_LOCAL_ATOMIC_ALIGNMENT"    );
+                HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_SVM_CAPABILITIES, sizeof(svm_cap), &svm_cap, NULL ), "clGetDeviceInfo failed" );
+                HGPU_output_flags( "CL_DEVICE_SVM_CAPABILITIES", svm_cap, HGPU_svm_capabilities, HGPU_FLAGS_NUMBER( HGPU_svm_capabilities ), HGPU_OUTPUT_FLAGS_LINES, device_opencl_c_version );
+
+                clGetDeviceInfoUint( devices[t], CL_DEVICE_PREFERRED_PLATFORM_ATOMIC_ALIGNMENT, "CL_DEVICE_PREFERRED_PLATFORM_ATOMIC_ALIGNMENT", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
+                clGetDeviceInfoUint( devices[t], CL_DEVICE_PREFERRED_GLOBAL_ATOMIC_ALIGNMENT,   "CL_DEVICE_PREFERRED_GLOBAL_ATOMIC_ALIGNMENT", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
+                clGetDeviceInfoUint( devices[t], CL_DEVICE_PREFERRED_LOCAL_ATOMIC_ALIGNMENT,    "CL_DEVICE_PREFERRED_LOCAL_ATOMIC_ALIGNMENT", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
             }
 #endif
 
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_EXECUTION_CAPABILITIES, sizeof(device_exec_cap), &device_exec_cap, NULL ), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_EXECUTION_CAPABILITIES" );
-                if( device_exec_cap & CL_EXEC_KERNEL        ) printf( "CL_EXEC_KERNEL "        );
-                if( device_exec_cap & CL_EXEC_NATIVE_KERNEL ) printf( "CL_EXEC_NATIVE_KERNEL " );
-            printf( "\n" );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_EXECUTION_CAPABILITIES, sizeof(device_exec_cap), &device_exec_cap, NULL ), "clGetDeviceInfo failed" );
+            HGPU_output_flags( "CL_DEVICE_EXECUTION_CAPABILITIES", device_exec_cap, HGPU_exec_capabilities, HGPU_FLAGS_NUMBER( HGPU_exec_capabilities ), HGPU_OUTPUT_FLAGS_INLINE, device_opencl_c_version );
 
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_QUEUE_PROPERTIES, sizeof(comqueue_properties), &comqueue_properties, NULL ), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_NSTR, "CL_DEVICE_QUEUE_PROPERTIES" );
-                if( comqueue_properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE ) printf( "CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE " );
-                if( comqueue_properties & CL_QUEUE_PROFILING_ENABLE              ) printf( "CL_QUEUE_PROFILING_ENABLE "              );
-            printf( "\n" );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_QUEUE_PROPERTIES, sizeof(comqueue_properties), &comqueue_properties, NULL ), "clGetDeviceInfo failed" );
+            HGPU_output_flags( "CL_DEVICE_QUEUE_PROPERTIES", comqueue_properties, HGPU_queue_properties, HGPU_FLAGS_NUMBER( HGPU_queue_properties ), HGPU_OUTPUT_FLAGS_INLINE, device_opencl_c_version );
 
 #if defined( CL_VERSION_2_0 )
             if( device_opencl_c_version >= HGPU_OPENCL_2_0 )
             {
-                clGetDeviceInfoUint( devices[t], CL_DEVICE_QUEUE_ON_DEVICE_PREFERRED_SIZE, "CL_DEVICE_QUEUE_ON_DEVICE_PREFERRED_SIZE" );
-                clGetDeviceInfoUint( devices[t], CL_DEVICE_QUEUE_ON_DEVICE_MAX_SIZE,       "CL_DEVICE_QUEUE_ON_DEVICE_MAX_SIZE"       );
+                clGetDeviceInfoUint( devices[t], CL_DEVICE_QUEUE_ON_DEVICE_PREFERRED_SIZE, "CL_DEVICE_QUEUE_ON_DEVICE_PREFERRED_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
+                clGetDeviceInfoUint( devices[t], CL_DEVICE_QUEUE_ON_DEVICE_MAX_SIZE,       "CL_DEVICE_QUEUE_ON_DEVICE_MAX_SIZE", HGPU_OUT_FMT_NONE, HGPU_OUTPUT_UNIT_BYTES );
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_MAX_ON_DEVICE_QUEUES,           "CL_DEVICE_MAX_ON_DEVICE_QUEUES"           );
                 clGetDeviceInfoUint( devices[t], CL_DEVICE_MAX_ON_DEVICE_EVENTS,           "CL_DEVICE_MAX_ON_DEVICE_EVENTS"           );
             }
 #endif
 
-            HGPU_GPU_error_message( clGetDeviceInfo( devices[t], CL_DEVICE_PLATFORM, sizeof(platform2), &platform2, NULL), "clGetDeviceInfo failed" );
-            printf( HGPU_OUT_FMT_LONGHEX, "CL_DEVICE_PLATFORM", (long long unsigned int) platform2 );
+            HGPU_GPU_error_message( HGPU_clGetDeviceInfo( devices[t], CL_DEVICE_PLATFORM, sizeof(platform2), &platform2, NULL), "clGetDeviceInfo failed" );
+            HGPU_output_hex( "CL_DEVICE_PLATFORM", (unsigned long long) platform2 );
+
+#ifndef HGPU_REPLAY_ONLY
+            if( bench_mask )
+                HGPU_bench_run( devices[t], device_opencl_c_version, bench_mask );
+#endif
+            HGPU_output_device_end();
         }
         delete[] devices;
     }
     delete[] platforms;
-    printf( "\n\n" );
+    HGPU_output_end();
+    HGPU_capture_close();
 }
 
 
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * @file     OpenCLInfo.h
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Common definitions: OpenCL C versions, vendors and output formats
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *****************************************************************************/
+
+#ifndef OPENCLINFO_H
+#define OPENCLINFO_H
+
+#define HGPU_OPENCL_VERSION_STR     "OpenCL C "
+#define HGPU_OPENCL_VERSION_1_0     HGPU_OPENCL_VERSION_STR"1.0"
+#define HGPU_OPENCL_VERSION_1_1     HGPU_OPENCL_VERSION_STR"1.1"
+#define HGPU_OPENCL_VERSION_1_2     HGPU_OPENCL_VERSION_STR"1.2"
+#define HGPU_OPENCL_VERSION_2_0     HGPU_OPENCL_VERSION_STR"2.0"
+
+#define HGPU_OPENCL_1_0             1
+#define HGPU_OPENCL_1_1             2
+#define HGPU_OPENCL_1_2             3
+#define HGPU_OPENCL_2_0             4
+
+#define HGPU_DEVICE_VENDOR_AMD      "Advanced Micro Devices"
+#define HGPU_DEVICE_VENDOR_NVIDIA   "NVIDIA"
+#define HGPU_DEVICE_VENDOR_INTEL    "Intel"
+
+#define HGPU_VENDOR_AMD             1
+#define HGPU_VENDOR_NVIDIA          2
+#define HGPU_VENDOR_INTEL           3
+
+#define HGPU_OUT_FMT_NSTR           "%-46s: "
+#define HGPU_OUT_FMT_END            "\n"
+#define HGPU_OUT_FMT_N0STR          "%s:\n"
+#define HGPU_OUT_FMT_TN             "\t%s\n"
+
+#define HGPU_OUT_FMT_STR0           HGPU_OUT_FMT_NSTR"%s"
+#define HGPU_OUT_FMT_HEX0           HGPU_OUT_FMT_NSTR"%#x"
+#define HGPU_OUT_FMT_LONGHEX0       HGPU_OUT_FMT_NSTR"%#llx"
+#define HGPU_OUT_FMT_UINT0          HGPU_OUT_FMT_NSTR"%u"
+#define HGPU_OUT_FMT_LONG0          HGPU_OUT_FMT_NSTR"%llu"
+
+#define HGPU_OUT_FMT_NSTRN          HGPU_OUT_FMT_NSTR"\n"
+#define HGPU_OUT_FMT_STR            HGPU_OUT_FMT_STR0"\n"
+#define HGPU_OUT_FMT_HEX            HGPU_OUT_FMT_HEX0"\n"
+#define HGPU_OUT_FMT_LONGHEX        HGPU_OUT_FMT_LONGHEX0"\n"
+#define HGPU_OUT_FMT_UINT           HGPU_OUT_FMT_UINT0"\n"
+#define HGPU_OUT_FMT_LONG           HGPU_OUT_FMT_LONG0"\n"
+
+#define HGPU_OUT_FMT_NONE           0
+#define HGPU_OUT_FMT_KB             1
+#define HGPU_OUT_FMT_MB             2
+#define HGPU_OUT_FMT_GB             3
+#define HGPU_OUT_FMT_MHz            4
+
+#endif
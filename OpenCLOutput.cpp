@@ -0,0 +1,684 @@
+/******************************************************************************
+ * @file     OpenCLOutput.cpp
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Typed report emitter: text, JSON Lines, CSV and MessagePack output
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+// Text format prints every value as soon as it is collected (the classic report).
+// Structured formats keep the fields of the current platform or device record
+// and write the whole record when it ends, so the stream grows device by device:
+//     json    - JSON Lines, one object per record:
+//               {"record":"device","platform":1,"device":1,"CL_DEVICE_NAME":"...",
+//                "CL_DEVICE_GLOBAL_MEM_SIZE":{"value":4294967296,"unit":"bytes"},
+//                "CL_DEVICE_TYPE":{"value":4,"flags":["GPU"]},"CL_DEVICE_MAX_WORK_ITEM_SIZES":[256,256,256],...}
+//     csv     - one row per field: platform,device,name,type,value,unit,flags
+//     msgpack - one map per record with the same layout as json
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <cstring>
+#else
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+#include "OpenCLOutput.h"
+
+
+#define HGPU_OUTPUT_FIELD_STR       0
+#define HGPU_OUTPUT_FIELD_UINT      1
+#define HGPU_OUTPUT_FIELD_HEX       2
+#define HGPU_OUTPUT_FIELD_BOOL      3
+#define HGPU_OUTPUT_FIELD_LIST      4
+#define HGPU_OUTPUT_FIELD_NAMES     5
+#define HGPU_OUTPUT_FIELD_FLAGS     6
+#define HGPU_OUTPUT_FIELD_REAL      7
+
+    struct HGPU_output_field
+    {
+        std::string        name;
+        int                type;
+        std::string        str;
+        unsigned long long value;
+        double             real;
+        const char*        unit;    // NULL for unitless values
+        std::vector<unsigned long long> values;
+        std::vector<std::string>        names;  // names of list items or of set flags
+    };
+
+    static int          HGPU_output_current_format = HGPU_OUTPUT_FORMAT_TEXT;
+    static bool         HGPU_output_record_device  = false;
+    static unsigned int HGPU_output_record_platform_id = 0;
+    static unsigned int HGPU_output_record_device_id   = 0;
+    static std::vector<HGPU_output_field> HGPU_output_record;
+
+    static const char* HGPU_output_field_types[] = { "str", "uint", "hex", "bool", "list", "names", "flags", "real" };
+
+
+    static bool
+    HGPU_output_text( void )
+    {
+        return ( HGPU_output_current_format == HGPU_OUTPUT_FORMAT_TEXT );
+    }
+
+    static HGPU_output_field&
+    HGPU_output_add( const char* name, int type )
+    {
+        HGPU_output_field field;
+        field.name  = name;
+        field.type  = type;
+        field.value = 0;
+        field.real  = 0.0;
+        field.unit  = NULL;
+        HGPU_output_record.push_back( field );
+        return HGPU_output_record.back();
+    }
+
+    static std::string
+    HGPU_output_number( unsigned long long value, bool hex = false )
+    {
+        char buf[32];
+        sprintf( buf, ( hex ? "%#llx" : "%llu" ), value );
+        return buf;
+    }
+
+    // empty for infinity and NaN, which have no JSON or CSV number form
+    static std::string
+    HGPU_output_real_number( double value )
+    {
+        char buf[32] = "";
+        if( ( value == value ) && ( value - value == 0.0 ) )
+            sprintf( buf, "%.6g", value );
+        return buf;
+    }
+
+// ------------------------------------------------------------- JSON
+
+    static void
+    HGPU_output_json_str( std::string& out, const std::string& value )
+    {
+        out += '"';
+        for( size_t i = 0; i < value.size(); i++ )
+        {
+            unsigned char c = (unsigned char) value[i];
+            switch( c )
+            {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n";  break;
+                case '\r': out += "\\r";  break;
+                case '\t': out += "\\t";  break;
+                default:
+                    if( c < 0x20 )
+                    {
+                        char buf[8];
+                        sprintf( buf, "\\u%04x", c );
+                        out += buf;
+                    }
+                    else
+                        out += (char) c;
+            }
+        }
+        out += '"';
+    }
+
+    static void
+    HGPU_output_json_value( std::string& out, const HGPU_output_field& field )
+    {
+        std::string value;
+        switch( field.type )
+        {
+            case HGPU_OUTPUT_FIELD_STR:
+                HGPU_output_json_str( value, field.str );
+                break;
+            case HGPU_OUTPUT_FIELD_UINT:
+            case HGPU_OUTPUT_FIELD_HEX:
+                value = HGPU_output_number( field.value );
+                break;
+            case HGPU_OUTPUT_FIELD_BOOL:
+                value = ( field.value ? "true" : "false" );
+                break;
+            case HGPU_OUTPUT_FIELD_REAL:
+                value = HGPU_output_real_number( field.real );
+                if( value.empty() )
+                    value = "null";
+                break;
+            case HGPU_OUTPUT_FIELD_LIST:
+                value = "[";
+                for( size_t i = 0; i < field.values.size(); i++ )
+                    value += ( i ? "," : "" ) + HGPU_output_number( field.values[i] );
+                value += "]";
+                break;
+            case HGPU_OUTPUT_FIELD_NAMES:
+                value = "[";
+                for( size_t i = 0; i < field.names.size(); i++ )
+                {
+                    if( i ) value += ",";
+                    HGPU_output_json_str( value, field.names[i] );
+                }
+                value += "]";
+                break;
+            case HGPU_OUTPUT_FIELD_FLAGS:
+                value = "{\"value\":" + HGPU_output_number( field.value ) + ",\"flags\":[";
+                for( size_t i = 0; i < field.names.size(); i++ )
+                {
+                    if( i ) value += ",";
+                    HGPU_output_json_str( value, field.names[i] );
+                }
+                value += "]}";
+                break;
+        }
+        if( field.unit )
+            out += "{\"value\":" + value + ",\"unit\":\"" + field.unit + "\"}";
+        else
+            out += value;
+    }
+
+    static void
+    HGPU_output_json_record( std::string& out )
+    {
+        out += ( HGPU_output_record_device ? "{\"record\":\"device\"" : "{\"record\":\"platform\"" );
+        out += ",\"platform\":" + HGPU_output_number( HGPU_output_record_platform_id );
+        if( HGPU_output_record_device )
+            out += ",\"device\":" + HGPU_output_number( HGPU_output_record_device_id );
+        for( size_t i = 0; i < HGPU_output_record.size(); i++ )
+        {
+            out += ",";
+            HGPU_output_json_str( out, HGPU_output_record[i].name );
+            out += ":";
+            HGPU_output_json_value( out, HGPU_output_record[i] );
+        }
+        out += "}\n";
+    }
+
+// ------------------------------------------------------------- CSV
+
+    static void
+    HGPU_output_csv_cell( std::string& out, const std::string& value, bool last = false )
+    {
+        if( value.find_first_of( ",\"\r\n" ) != std::string::npos )
+        {
+            out += '"';
+            for( size_t i = 0; i < value.size(); i++ )
+            {
+                if( value[i] == '"' ) out += '"';
+                out += value[i];
+            }
+            out += '"';
+        }
+        else
+            out += value;
+        out += ( last ? "\n" : "," );
+    }
+
+    static std::string
+    HGPU_output_csv_join( const std::vector<std::string>& names )
+    {
+        std::string result;
+        for( size_t i = 0; i < names.size(); i++ )
+            result += ( i ? ";" : "" ) + names[i];
+        return result;
+    }
+
+    static void
+    HGPU_output_csv_record( std::string& out )
+    {
+        std::string platform = HGPU_output_number( HGPU_output_record_platform_id );
+        std::string device   = ( HGPU_output_record_device ? HGPU_output_number( HGPU_output_record_device_id ) : "" );
+        for( size_t i = 0; i < HGPU_output_record.size(); i++ )
+        {
+            const HGPU_output_field& field = HGPU_output_record[i];
+            std::string value;
+            std::string flags;
+            switch( field.type )
+            {
+                case HGPU_OUTPUT_FIELD_STR:   value = field.str;                                  break;
+                case HGPU_OUTPUT_FIELD_UINT:  value = HGPU_output_number( field.value );          break;
+                case HGPU_OUTPUT_FIELD_HEX:   value = HGPU_output_number( field.value, true );    break;
+                case HGPU_OUTPUT_FIELD_BOOL:  value = ( field.value ? "true" : "false" );         break;
+                case HGPU_OUTPUT_FIELD_REAL:  value = HGPU_output_real_number( field.real );      break;
+                case HGPU_OUTPUT_FIELD_NAMES: value = HGPU_output_csv_join( field.names );        break;
+                case HGPU_OUTPUT_FIELD_FLAGS:
+                    value = HGPU_output_number( field.value, true );
+                    flags = HGPU_output_csv_join( field.names );
+                    break;
+                case HGPU_OUTPUT_FIELD_LIST:
+                    for( size_t j = 0; j < field.values.size(); j++ )
+                        value += ( j ? ";" : "" ) + HGPU_output_number( field.values[j] );
+                    break;
+            }
+            HGPU_output_csv_cell( out, platform );
+            HGPU_output_csv_cell( out, device );
+            HGPU_output_csv_cell( out, field.name );
+            HGPU_output_csv_cell( out, HGPU_output_field_types[field.type] );
+            HGPU_output_csv_cell( out, value );
+            HGPU_output_csv_cell( out, ( field.unit ? field.unit : "" ) );
+            HGPU_output_csv_cell( out, flags, true );
+        }
+    }
+
+// ------------------------------------------------------------- MessagePack
+
+    static void
+    HGPU_output_msgpack_head( std::string& out, unsigned char code, unsigned long long value, int bytes )
+    {
+        out += (char) code;
+        for( int i = bytes - 1; i >= 0; i-- )
+            out += (char) ( ( value >> ( 8 * i ) ) & 0xFF );
+    }
+
+    static void
+    HGPU_output_msgpack_uint( std::string& out, unsigned long long value )
+    {
+        if( value < 0x80 )                out += (char) value;
+        else if( value <= 0xFFULL )       HGPU_output_msgpack_head( out, 0xcc, value, 1 );
+        else if( value <= 0xFFFFULL )     HGPU_output_msgpack_head( out, 0xcd, value, 2 );
+        else if( value <= 0xFFFFFFFFULL ) HGPU_output_msgpack_head( out, 0xce, value, 4 );
+        else                              HGPU_output_msgpack_head( out, 0xcf, value, 8 );
+    }
+
+    static void
+    HGPU_output_msgpack_real( std::string& out, double value )
+    {
+        unsigned long long bits = 0;
+        memcpy( &bits, &value, sizeof(bits) );
+        HGPU_output_msgpack_head( out, 0xcb, bits, 8 );
+    }
+
+    static void
+    HGPU_output_msgpack_str( std::string& out, const std::string& value )
+    {
+        size_t length = value.size();
+        if( length < 32 )            out += (char) ( 0xa0 | length );
+        else if( length <= 0xFF )    HGPU_output_msgpack_head( out, 0xd9, length, 1 );
+        else if( length <= 0xFFFF )  HGPU_output_msgpack_head( out, 0xda, length, 2 );
+        else                         HGPU_output_msgpack_head( out, 0xdb, length, 4 );
+        out += value;
+    }
+
+    static void
+    HGPU_output_msgpack_array( std::string& out, size_t length )
+    {
+        if( length < 16 )            out += (char) ( 0x90 | length );
+        else if( length <= 0xFFFF )  HGPU_output_msgpack_head( out, 0xdc, length, 2 );
+        else                         HGPU_output_msgpack_head( out, 0xdd, length, 4 );
+    }
+
+    static void
+    HGPU_output_msgpack_map( std::string& out, size_t length )
+    {
+        if( length < 16 )            out += (char) ( 0x80 | length );
+        else if( length <= 0xFFFF )  HGPU_output_msgpack_head( out, 0xde, length, 2 );
+        else                         HGPU_output_msgpack_head( out, 0xdf, length, 4 );
+    }
+
+    static void
+    HGPU_output_msgpack_value( std::string& out, const HGPU_output_field& field )
+    {
+        if( field.unit )
+        {
+            HGPU_output_msgpack_map( out, 2 );
+            HGPU_output_msgpack_str( out, "value" );
+        }
+        switch( field.type )
+        {
+            case HGPU_OUTPUT_FIELD_STR:
+                HGPU_output_msgpack_str( out, field.str );
+                break;
+            case HGPU_OUTPUT_FIELD_UINT:
+            case HGPU_OUTPUT_FIELD_HEX:
+                HGPU_output_msgpack_uint( out, field.value );
+                break;
+            case HGPU_OUTPUT_FIELD_BOOL:
+                out += (char) ( field.value ? 0xc3 : 0xc2 );
+                break;
+            case HGPU_OUTPUT_FIELD_REAL:
+                HGPU_output_msgpack_real( out, field.real );
+                break;
+            case HGPU_OUTPUT_FIELD_LIST:
+                HGPU_output_msgpack_array( out, field.values.size() );
+                for( size_t i = 0; i < field.values.size(); i++ )
+                    HGPU_output_msgpack_uint( out, field.values[i] );
+                break;
+            case HGPU_OUTPUT_FIELD_NAMES:
+                HGPU_output_msgpack_array( out, field.names.size() );
+                for( size_t i = 0; i < field.names.size(); i++ )
+                    HGPU_output_msgpack_str( out, field.names[i] );
+                break;
+            case HGPU_OUTPUT_FIELD_FLAGS:
+                HGPU_output_msgpack_map( out, 2 );
+                HGPU_output_msgpack_str( out, "value" );
+                HGPU_output_msgpack_uint( out, field.value );
+                HGPU_output_msgpack_str( out, "flags" );
+                HGPU_output_msgpack_array( out, field.names.size() );
+                for( size_t i = 0; i < field.names.size(); i++ )
+                    HGPU_output_msgpack_str( out, field.names[i] );
+                break;
+        }
+        if( field.unit )
+        {
+            HGPU_output_msgpack_str( out, "unit" );
+            HGPU_output_msgpack_str( out, field.unit );
+        }
+    }
+
+    static void
+    HGPU_output_msgpack_record( std::string& out )
+    {
+        HGPU_output_msgpack_map( out, HGPU_output_record.size() + ( HGPU_output_record_device ? 3 : 2 ) );
+        HGPU_output_msgpack_str( out, "record" );
+        HGPU_output_msgpack_str( out, ( HGPU_output_record_device ? "device" : "platform" ) );
+        HGPU_output_msgpack_str( out, "platform" );
+        HGPU_output_msgpack_uint( out, HGPU_output_record_platform_id );
+        if( HGPU_output_record_device )
+        {
+            HGPU_output_msgpack_str( out, "device" );
+            HGPU_output_msgpack_uint( out, HGPU_output_record_device_id );
+        }
+        for( size_t i = 0; i < HGPU_output_record.size(); i++ )
+        {
+            HGPU_output_msgpack_str( out, HGPU_output_record[i].name );
+            HGPU_output_msgpack_value( out, HGPU_output_record[i] );
+        }
+    }
+
+// ------------------------------------------------------------- records
+
+    static void
+    HGPU_output_record_begin( bool device, unsigned int platform, unsigned int device_id )
+    {
+        HGPU_output_record.clear();
+        HGPU_output_record_device      = device;
+        HGPU_output_record_platform_id = platform;
+        HGPU_output_record_device_id   = device_id;
+    }
+
+    static void
+    HGPU_output_record_end( void )
+    {
+        std::string out;
+        switch( HGPU_output_current_format )
+        {
+            case HGPU_OUTPUT_FORMAT_JSON:    HGPU_output_json_record( out );    break;
+            case HGPU_OUTPUT_FORMAT_CSV:     HGPU_output_csv_record( out );     break;
+            case HGPU_OUTPUT_FORMAT_MSGPACK: HGPU_output_msgpack_record( out ); break;
+        }
+        if( out.size() )
+            fwrite( out.data(), 1, out.size(), stdout );
+        fflush( stdout );
+        HGPU_output_record.clear();
+    }
+
+    int
+    HGPU_output_parse( const char* format_name )
+    {
+        if( !strcmp( format_name, "text"    ) ) return HGPU_OUTPUT_FORMAT_TEXT;
+        if( !strcmp( format_name, "json"    ) ) return HGPU_OUTPUT_FORMAT_JSON;
+        if( !strcmp( format_name, "csv"     ) ) return HGPU_OUTPUT_FORMAT_CSV;
+        if( !strcmp( format_name, "msgpack" ) ) return HGPU_OUTPUT_FORMAT_MSGPACK;
+        return 0;
+    }
+
+    void
+    HGPU_output_open( int format )
+    {
+        HGPU_output_current_format = format;
+#ifdef _WIN32
+        if( format == HGPU_OUTPUT_FORMAT_MSGPACK )
+            _setmode( _fileno( stdout ), _O_BINARY );
+#endif
+    }
+
+    int
+    HGPU_output_format( void )
+    {
+        return HGPU_output_current_format;
+    }
+
+    void
+    HGPU_output_begin( unsigned int platforms_number )
+    {
+        if( HGPU_output_text() )
+            printf( "Platforms available: %u\n", platforms_number );
+        else if( HGPU_output_current_format == HGPU_OUTPUT_FORMAT_CSV )
+            printf( HGPU_OUTPUT_CSV_HEADER );
+    }
+
+    void
+    HGPU_output_platform_begin( unsigned int platform )
+    {
+        if( HGPU_output_text() )
+        {
+            printf( "--------------------------------------------------------------------------------------\n" );
+            printf( "Info on platform %u\n", platform );
+        }
+        else
+            HGPU_output_record_begin( false, platform, 0 );
+    }
+
+    void
+    HGPU_output_platform_end( unsigned int devices_number )
+    {
+        if( HGPU_output_text() )
+            printf( "Devices available: %u\n", devices_number );
+        else
+        {
+            HGPU_output_add( "devices", HGPU_OUTPUT_FIELD_UINT ).value = devices_number;
+            HGPU_output_record_end();
+        }
+    }
+
+    void
+    HGPU_output_device_begin( unsigned int platform, unsigned int device )
+    {
+        if( HGPU_output_text() )
+        {
+            printf( "--------------------------------------------------------------------------------------\n" );
+            printf( "Info on device %u\n", device );
+        }
+        else
+            HGPU_output_record_begin( true, platform, device );
+    }
+
+    void
+    HGPU_output_device_end( void )
+    {
+        if( !HGPU_output_text() )
+            HGPU_output_record_end();
+    }
+
+    void
+    HGPU_output_end( void )
+    {
+        if( HGPU_output_text() )
+            printf( "\n\n" );
+        fflush( stdout );
+    }
+
+    void
+    HGPU_output_message( const char* format, ... )
+    {
+        va_list args;
+        va_start( args, format );
+        vfprintf( ( HGPU_output_text() ? stdout : stderr ), format, args );
+        va_end( args );
+    }
+
+    void
+    HGPU_output_str( const char* name, const char* value )
+    {
+        if( HGPU_output_text() )
+            printf( HGPU_OUT_FMT_STR, name, value );
+        else
+            HGPU_output_add( name, HGPU_OUTPUT_FIELD_STR ).str = value;
+    }
+
+    void
+    HGPU_output_uint( const char* name, unsigned long long value, int fmt_type, const char* unit )
+    {
+        if( HGPU_output_text() )
+        {
+            printf( HGPU_OUT_FMT_LONG0, name, value );
+            switch( fmt_type )
+            {
+                case HGPU_OUT_FMT_KB:  printf( " (%5.3f KB)", ( value / 1024. ) );                 break;
+                case HGPU_OUT_FMT_MB:  printf( " (%5.3f MB)", ( value / 1024. / 1024. ) );         break;
+                case HGPU_OUT_FMT_GB:  printf( " (%5.3f GB)", ( value / 1024. / 1024. / 1024. ) ); break;
+                case HGPU_OUT_FMT_MHz: printf( " MHz" );                                           break;
+            }
+            printf( HGPU_OUT_FMT_END );
+        }
+        else
+        {
+            HGPU_output_field& field = HGPU_output_add( name, HGPU_OUTPUT_FIELD_UINT );
+            field.value = value;
+            field.unit  = unit;
+        }
+    }
+
+    void
+    HGPU_output_real( const char* name, double value, const char* unit )
+    {
+        if( HGPU_output_text() )
+            printf( HGPU_OUT_FMT_NSTR"%.3f%s%s\n", name, value, ( unit ? " " : "" ), ( unit ? unit : "" ) );
+        else
+        {
+            HGPU_output_field& field = HGPU_output_add( name, HGPU_OUTPUT_FIELD_REAL );
+            field.real = value;
+            field.unit = unit;
+        }
+    }
+
+    void
+    HGPU_output_hex( const char* name, unsigned long long value )
+    {
+        if( HGPU_output_text() )
+            printf( HGPU_OUT_FMT_LONGHEX, name, value );
+        else
+            HGPU_output_add( name, HGPU_OUTPUT_FIELD_HEX ).value = value;
+    }
+
+    void
+    HGPU_output_bool( const char* name, bool value )
+    {
+        if( HGPU_output_text() )
+            printf( HGPU_OUT_FMT_STR, name, ( value ? "Yes" : "No" ) );
+        else
+            HGPU_output_add( name, HGPU_OUTPUT_FIELD_BOOL ).value = value;
+    }
+
+    void
+    HGPU_output_list( const char* name, const std::vector<unsigned long long>& values, const char* unit, int style, unsigned long long scale )
+    {
+        if( HGPU_output_text() )
+        {
+            printf( HGPU_OUT_FMT_NSTR, name );
+            for( size_t i = 0; i < values.size(); i++ )
+            {
+                if( ( style == HGPU_OUTPUT_LIST_JOINED ) && i ) printf( ", " );
+                printf( "%llu", values[i] );
+                if( style == HGPU_OUTPUT_LIST_TERMINATED ) printf( " " );
+            }
+            printf( "\n" );
+        }
+        else
+        {
+            HGPU_output_field& field = HGPU_output_add( name, HGPU_OUTPUT_FIELD_LIST );
+            field.values = values;
+            field.unit   = unit;
+            for( size_t i = 0; i < field.values.size(); i++ )
+                field.values[i] *= scale;
+        }
+    }
+
+    void
+    HGPU_output_names( const char* name, const std::vector<std::string>& names )
+    {
+        if( HGPU_output_text() )
+        {
+            printf( HGPU_OUT_FMT_NSTR, name );
+            for( size_t i = 0; i < names.size(); i++ )
+                printf( "%s ", names[i].c_str() );
+            printf( "\n" );
+        }
+        else
+            HGPU_output_add( name, HGPU_OUTPUT_FIELD_NAMES ).names = names;
+    }
+
+    void
+    HGPU_output_flags( const char* name, unsigned long long value, const HGPU_output_flag* flags, size_t flags_number, int style, int opencl_c_version )
+    {
+        if( HGPU_output_text() )
+        {
+            switch( style )
+            {
+                case HGPU_OUTPUT_FLAGS_INLINE: printf( HGPU_OUT_FMT_NSTR, name );              break;
+                case HGPU_OUTPUT_FLAGS_YESNO:  printf( "%s configuration:\n", name );         break;
+                case HGPU_OUTPUT_FLAGS_LINES:  printf( HGPU_OUT_FMT_N0STR, name );             break;
+            }
+            for( size_t i = 0; i < flags_number; i++ )
+            {
+                if( flags[i].opencl_c_version > opencl_c_version )
+                    continue;
+                bool set = ( ( value & flags[i].bit ) != 0 );
+                switch( style )
+                {
+                    case HGPU_OUTPUT_FLAGS_INLINE:
+                        if( set ) printf( "%s ", flags[i].name );
+                        break;
+                    case HGPU_OUTPUT_FLAGS_YESNO:
+                        printf( "\t%-23s %s\n", ( std::string( flags[i].name ) + ":" ).c_str(), ( set ? "Yes" : "No" ) );
+                        break;
+                    case HGPU_OUTPUT_FLAGS_LINES:
+                        if( set ) printf( HGPU_OUT_FMT_TN, flags[i].name );
+                        break;
+                }
+            }
+            if( style == HGPU_OUTPUT_FLAGS_INLINE )
+                printf( "\n" );
+        }
+        else
+        {
+            HGPU_output_field& field = HGPU_output_add( name, HGPU_OUTPUT_FIELD_FLAGS );
+            field.value = value;
+            for( size_t i = 0; i < flags_number; i++ )
+                if( ( flags[i].opencl_c_version <= opencl_c_version ) && ( value & flags[i].bit ) )
+                    field.names.push_back( flags[i].name );
+        }
+    }
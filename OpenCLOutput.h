@@ -0,0 +1,103 @@
+/******************************************************************************
+ * @file     OpenCLOutput.h
+ * @author   Vadim Demchik <vadimdi@yahoo.com>
+ * @version  2.0
+ *
+ * @brief    [OpenCLInfo]
+ *           Typed report emitter: text, JSON Lines, CSV and MessagePack output
+ *
+ *
+ * @section  LICENSE
+ *
+ * Copyright (c) 2015 Vadim Demchik
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *    Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+#ifndef OPENCLOUTPUT_H
+#define OPENCLOUTPUT_H
+
+#include <string>
+#include <vector>
+
+#include "OpenCLInfo.h"
+
+
+#define HGPU_OUTPUT_FORMAT_TEXT         1
+#define HGPU_OUTPUT_FORMAT_JSON         2
+#define HGPU_OUTPUT_FORMAT_CSV          3
+#define HGPU_OUTPUT_FORMAT_MSGPACK      4
+
+#define HGPU_OUTPUT_LIST_TERMINATED     0   // text: "v v v "
+#define HGPU_OUTPUT_LIST_JOINED         1   // text: "v, v, v"
+
+#define HGPU_OUTPUT_FLAGS_INLINE        0   // text: "NAME: FLAG FLAG "
+#define HGPU_OUTPUT_FLAGS_YESNO         1   // text: "NAME configuration:" and "\tFLAG: Yes/No" per known flag
+#define HGPU_OUTPUT_FLAGS_LINES         2   // text: "NAME:" and "\tFLAG" per set flag
+
+#define HGPU_OUTPUT_UNIT_BYTES          "bytes"
+#define HGPU_OUTPUT_UNIT_BITS           "bits"
+#define HGPU_OUTPUT_UNIT_MHZ            "MHz"
+#define HGPU_OUTPUT_UNIT_NS             "ns"
+#define HGPU_OUTPUT_UNIT_GBPS           "GB/s"
+#define HGPU_OUTPUT_UNIT_PER_S          "1/s"
+
+#define HGPU_OUTPUT_CSV_HEADER          "platform,device,name,type,value,unit,flags\n"
+
+    struct HGPU_output_flag
+    {
+        unsigned long long bit;
+        const char*        name;
+        int                opencl_c_version;    // lowest device OpenCL C version (HGPU_OPENCL_*) reporting the flag, 0 for any
+    };
+
+    // parse output format name from command line; returns 0 for unknown name
+    int    HGPU_output_parse( const char* format_name );
+    // select output format; text is printed as collected, other formats are written per platform/device record
+    void   HGPU_output_open( int format );
+    int    HGPU_output_format( void );
+
+    void   HGPU_output_begin( unsigned int platforms_number );
+    void   HGPU_output_platform_begin( unsigned int platform );
+    void   HGPU_output_platform_end( unsigned int devices_number );
+    void   HGPU_output_device_begin( unsigned int platform, unsigned int device );
+    void   HGPU_output_device_end( void );
+    void   HGPU_output_end( void );
+
+    // diagnostics: stdout in text format, stderr otherwise
+    void   HGPU_output_message( const char* format, ... );
+
+    void   HGPU_output_str(   const char* name, const char* value );
+    // fmt_type (HGPU_OUT_FMT_*) selects text suffix only; unit (HGPU_OUTPUT_UNIT_*) is the typed unit, NULL for counts
+    void   HGPU_output_uint(  const char* name, unsigned long long value, int fmt_type = HGPU_OUT_FMT_NONE, const char* unit = NULL );
+    void   HGPU_output_real(  const char* name, double value, const char* unit = NULL );
+    void   HGPU_output_hex(   const char* name, unsigned long long value );
+    void   HGPU_output_bool(  const char* name, bool value );
+    // text prints values as given; structured formats carry values * scale in unit
+    void   HGPU_output_list(  const char* name, const std::vector<unsigned long long>& values, const char* unit, int style, unsigned long long scale = 1 );
+    void   HGPU_output_names( const char* name, const std::vector<std::string>& names );
+    // flags newer than device opencl_c_version are not reported
+    void   HGPU_output_flags( const char* name, unsigned long long value, const HGPU_output_flag* flags, size_t flags_number, int style, int opencl_c_version );
+
+#endif